@@ -1,10 +1,17 @@
 #include <iostream>
 #include <fstream>
+#include <filesystem>
 #include <algorithm>
 #include <string>
 #include <regex>
 #include <bitset>
+#include <cstdint>
 #include <map>
+#include <vector>
+#include <iomanip>
+#include <chrono>
+#include <stdexcept>
+#include "Stats.h"
 
 using namespace std;
 
@@ -12,8 +19,9 @@ enum class Command { A_COMMAND, C_COMMAND, L_COMMAND };
 
 class Parser {
 private:
-    ifstream ifs;
+    istream& ifs;
     string word, symbol, dest, comp, jump;
+    string nextmark, mark; // the last "//@ ..." comment (VMtranslator --map) before word and before this command
     Command commandtype;
     smatch m;
 
@@ -21,14 +29,14 @@ private:
         static regex EX_COMMENT(R"(//.*)");
         while (true) {
             if (!getline(ifs, word)) return;
+            if (word.compare(0, 4, "//@ ") == 0) nextmark = word.substr(4);
             word = regex_replace(word, EX_COMMENT, "");
             word.erase(remove(word.begin(), word.end(), ' '), word.end());
             if (word.size()) break;
         }
     }
 public:
-    Parser(string filename) {
-        ifs.open(filename, ios::in);
+    Parser(istream& is) : ifs(is) {
         NextWord();
     }
 
@@ -39,6 +47,7 @@ public:
         static regex L_MATCH(R"(^\([\w\.\$:]+\)$)");
         static regex C_MATCH(R"((A?M?D?=)?([01AMD&!|+\-]*)(;[A-Z]*)?)");
 
+        mark = nextmark;
         if (regex_match(word, m, A_MATCH)) {
             commandtype = Command::A_COMMAND;
             symbol = m.str().substr(1);
@@ -67,6 +76,8 @@ public:
     string Comp() { return comp; }
 
     string Jump() { return jump; }
+
+    string Mark() { return mark; }
 };
 
 class Code {
@@ -144,50 +155,309 @@ public:
     int GetAddress(string symbol) { return mp[symbol]; }
 };
 
-int main(int argc, char** argv) {
-    string filename = argv[1];
-
-    Parser ps(filename);
-    Code cd;
-    SymbolTable st;
-
+// first pass: the address of every label, also returned in program order
+vector<pair<string, int> > DefineLabels(istream& is, SymbolTable& st) {
+    Parser ps(is);
+    vector<pair<string, int> > labels;
     int address = 0;
     while (ps.HasMoreCommands()) {
         ps.Advance();
         if (ps.CommandType() == Command::L_COMMAND) {
             st.AddEntry(ps.Symbol(), address);
+            labels.push_back({ ps.Symbol(), address });
             --address;
         }
         ++address;
     }
+    return labels;
+}
 
-    ofstream ofs(filename.substr(0, filename.size() - 3) + "hack");
+// the words from each function label (one without a '$') up to the next
+void CountFunctions(const vector<pair<string, int> >& labels, int size, Stats& stats) {
+    vector<pair<string, int> > functions;
+    for (auto& label : labels)
+        if (label.first.find('$') == string::npos) functions.push_back(label);
+    for (size_t i = 0; i < functions.size(); ++i)
+        stats.Function(functions[i].first, (i + 1 < functions.size() ? functions[i + 1].second : size) - functions[i].second);
+}
+
+bool IsNumber(const string& symbol) {
+    return all_of(symbol.begin(), symbol.end(), [](char c) { return isdigit(c); });
+}
 
-    ps = Parser(filename);
+uint16_t AWord(unsigned int num) {
+    return num & 0x7fff;
+}
+
+uint16_t CWord(Parser& ps, Code& cd) {
+    string comp = cd.Comp(ps.Comp());
+    string dest = cd.Dest(ps.Dest());
+    string jump = cd.Jump(ps.Jump());
+    return stoi("111" + comp + dest + jump, nullptr, 2);
+}
+
+// a word as a line of a .hack file
+string Binary(uint16_t word) {
+    return bitset<16>(word).to_string();
+}
+
+// second pass: one machine word per instruction, variables get RAM from 16
+vector<uint16_t> Encode(istream& is, SymbolTable& st) {
+    Parser ps(is);
+    Code cd;
+    vector<uint16_t> words;
     int ram = 16;
     while (ps.HasMoreCommands()) {
         ps.Advance();
         if (ps.CommandType() == Command::L_COMMAND) continue;
-        string res;
+        uint16_t res;
         if (ps.CommandType() == Command::A_COMMAND) {
             string symbol = ps.Symbol();
             unsigned int num = 0;
-            if (all_of(symbol.begin(), symbol.end(), [](char c) { return isdigit(c); })) num = stoi(symbol);
+            if (IsNumber(symbol)) num = stoi(symbol);
             else {
                 if (!st.Contains(symbol)) st.AddEntry(symbol, ram++);
                 num = st.GetAddress(symbol);
             }
-            bitset<15> bs(num);
-            res = "0" + bs.to_string();
+            res = AWord(num);
         } else {
-            string comp = cd.Comp(ps.Comp());
-            string dest = cd.Dest(ps.Dest());
-            string jump = cd.Jump(ps.Jump());
-            res = "111" + comp + dest + jump;
+            res = CWord(ps, cd);
         }
-        ofs << res << endl;
+        words.push_back(res);
     }
+    return words;
+}
 
+// the address each "//@ file line function" comment starts from, so a profiler can
+// name the VM line behind any ROM address. Code before the first one is "- 0 (unknown)"
+vector<pair<int, string> > SourceMap(istream& is) {
+    Parser ps(is);
+    vector<pair<int, string> > map;
+    int address = 0;
+    while (ps.HasMoreCommands()) {
+        ps.Advance();
+        if (ps.CommandType() == Command::L_COMMAND) continue;
+        string mark = ps.Mark().empty() ? "- 0 (unknown)" : ps.Mark();
+        if (map.empty() || map.back().second != mark) map.push_back({ address, mark });
+        ++address;
+    }
+    return map;
+}
+
+// a relocatable piece of a program (one class, the OS, the bootstrap), addresses counted from 0
+// labels with a '$' are internal to the object (VMtranslator puts one in every label it makes up),
+// the others are exported. Symbols it does not define are left for the linker, which makes
+// them variables if no object exports them
+struct Object {
+    vector<uint16_t> words;
+    vector<pair<string, int> > exports; // label, address in the object
+    vector<int> relocations;            // words holding an address in the object
+    vector<pair<string, int> > imports; // symbol, word that refers to it
+
+    // "// object", then one section per table, each headed by its size
+    void Write(ostream& os) const {
+        os << "// object" << endl
+            << "words " << words.size() << endl;
+        for (uint16_t word : words) os << Binary(word) << endl;
+        os << "exports " << exports.size() << endl;
+        for (auto& [label, address] : exports) os << label << " " << address << endl;
+        os << "relocations " << relocations.size() << endl;
+        for (int address : relocations) os << address << endl;
+        os << "imports " << imports.size() << endl;
+        for (auto& [symbol, address] : imports) os << symbol << " " << address << endl;
+    }
+
+    static Object Read(istream& is) {
+        Object obj;
+        string word;
+        size_t n;
+        getline(is, word);
+        if (word != "// object") throw runtime_error("not an object file");
+        is >> word >> n;
+        obj.words.resize(n);
+        for (auto& w : obj.words) {
+            is >> word;
+            w = stoi(word, nullptr, 2);
+        }
+        is >> word >> n;
+        obj.exports.resize(n);
+        for (auto& [label, address] : obj.exports) is >> label >> address;
+        is >> word >> n;
+        obj.relocations.resize(n);
+        for (int& address : obj.relocations) is >> address;
+        is >> word >> n;
+        obj.imports.resize(n);
+        for (auto& [symbol, address] : obj.imports) is >> symbol >> address;
+        if (!is) throw runtime_error("truncated object file");
+        return obj;
+    }
+};
+
+// second pass for an object: only numbers and predefined symbols are final
+Object EncodeObject(istream& is, const vector<pair<string, int> >& labels) {
+    map<string, int> defined(labels.begin(), labels.end());
+    SymbolTable predefined;
+    Parser ps(is);
+    Code cd;
+    Object obj;
+    for (auto& [label, address] : labels)
+        if (label.find('$') == string::npos) obj.exports.push_back({ label, address });
+    while (ps.HasMoreCommands()) {
+        ps.Advance();
+        if (ps.CommandType() == Command::L_COMMAND) continue;
+        int address = obj.words.size();
+        if (ps.CommandType() == Command::A_COMMAND) {
+            string symbol = ps.Symbol();
+            auto label = defined.find(symbol);
+            if (IsNumber(symbol)) {
+                obj.words.push_back(AWord(stoi(symbol)));
+            } else if (predefined.Contains(symbol)) {
+                obj.words.push_back(AWord(predefined.GetAddress(symbol)));
+            } else if (label != defined.end()) {
+                obj.words.push_back(AWord(label->second));
+                obj.relocations.push_back(address);
+            } else {
+                obj.words.push_back(AWord(0));
+                obj.imports.push_back({ symbol, address });
+            }
+        } else {
+            obj.words.push_back(CWord(ps, cd));
+        }
+    }
+    return obj;
+}
+
+// an .asm is assembled into the .hobj next to it, unless that one is already newer, and an .hobj
+// is read as it is. HackLink and JackBuild load objects only through here
+Object LoadObject(const string& filename, bool& assembled) {
+    filesystem::path path = filename, objpath = path;
+    objpath.replace_extension(".hobj");
+    assembled = path.extension() == ".asm"
+        && (!filesystem::exists(objpath) || filesystem::last_write_time(objpath) < filesystem::last_write_time(path));
+    if (assembled) {
+        SymbolTable st;
+        ifstream labels(filename);
+        if (!labels) throw runtime_error("cannot open " + filename);
+        vector<pair<string, int> > labeladdresses = DefineLabels(labels, st);
+        ifstream program(filename);
+        Object obj = EncodeObject(program, labeladdresses);
+        ofstream ofs(objpath);
+        obj.Write(ofs);
+        return obj;
+    }
+    ifstream ifs(objpath);
+    if (!ifs) throw runtime_error("cannot open " + objpath.string());
+    return Object::Read(ifs);
+}
+
+// the objects go into ROM in the order given. Symbols no object exports become variables
+// from RAM 16 in the order they are first used, as when the whole program is assembled at once.
+// A '$' symbol belongs to the object that uses it, so one it does not define is an error
+vector<uint16_t> Link(const vector<Object>& objects, int& variablecount) {
+    map<string, int> labels;
+    vector<int> bases;
+    int size = 0;
+    for (auto& obj : objects) {
+        bases.push_back(size);
+        for (auto& [label, address] : obj.exports)
+            if (!labels.emplace(label, size + address).second) throw runtime_error("label " + label + " is defined twice");
+        size += obj.words.size();
+    }
+    if (size > 32768) throw runtime_error("program has " + to_string(size) + " words, ROM holds 32768");
+
+    vector<uint16_t> words;
+    words.reserve(size);
+    map<string, int> variables;
+    int ram = 16;
+    for (size_t i = 0; i < objects.size(); ++i) {
+        auto& obj = objects[i];
+        words.insert(words.end(), obj.words.begin(), obj.words.end());
+        for (int address : obj.relocations) {
+            uint16_t& word = words[bases[i] + address];
+            word = AWord(word + bases[i]);
+        }
+        for (auto& [symbol, address] : obj.imports) {
+            auto label = labels.find(symbol);
+            int value;
+            if (label != labels.end()) {
+                value = label->second;
+            } else if (symbol.find('$') != string::npos) {
+                throw runtime_error(symbol + " is not defined in the object that uses it");
+            } else {
+                auto variable = variables.emplace(symbol, ram);
+                if (variable.second) ++ram;
+                value = variable.first->second;
+            }
+            words[bases[i] + address] = AWord(value);
+        }
+    }
+    variablecount = variables.size();
+    return words;
+}
+
+#ifndef NO_MAIN
+int main(int argc, char** argv) {
+    string filename, statsfile;
+    bool printstats = false, makeobject = false, makemap = false;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg == "--obj") makeobject = true;
+        else if (arg == "--map") makemap = true;
+        else if (arg == "--stats") printstats = true;
+        else if (arg.rfind("--stats=", 0) == 0) statsfile = arg.substr(8);
+        else filename = arg;
+    }
+    Stats stats;
+
+    SymbolTable st;
+    ifstream labels(filename);
+    vector<pair<string, int> > labeladdresses = DefineLabels(labels, st);
+    stats.Lap("define_labels");
+
+    if (makeobject) {
+        ifstream program(filename);
+        Object obj = EncodeObject(program, labeladdresses);
+        stats.Lap("encode");
+        ofstream ofs(filename.substr(0, filename.size() - 3) + "hobj");
+        obj.Write(ofs);
+        ofs.close();
+        stats.Lap("write");
+        if (printstats || !statsfile.empty()) {
+            stats.Count("instructions", obj.words.size());
+            stats.Count("exports", obj.exports.size());
+            stats.Count("relocations", obj.relocations.size());
+            stats.Count("imports", obj.imports.size());
+        }
+        if (printstats) stats.Print(cout, "words");
+        if (!statsfile.empty()) stats.WriteJson(statsfile, "Assembler", "words");
+        return 0;
+    }
+
+    ifstream program(filename);
+    vector<uint16_t> words = Encode(program, st);
+    stats.Lap("encode");
+
+    ofstream ofs(filename.substr(0, filename.size() - 3) + "hack");
+    for (uint16_t word : words) ofs << Binary(word) << endl;
+    ofs.close();
+    stats.Lap("write");
+
+    if (makemap) {
+        ifstream marks(filename);
+        ofstream map(filename.substr(0, filename.size() - 3) + "map");
+        map << "// map" << endl;
+        for (auto& [address, mark] : SourceMap(marks)) map << address << " " << mark << endl;
+        stats.Lap("map");
+    }
+
+    if (printstats || !statsfile.empty()) {
+        stats.Count("instructions", words.size());
+        stats.Count("labels", labeladdresses.size());
+        CountFunctions(labeladdresses, words.size(), stats);
+    }
+    if (printstats) stats.Print(cout, "words");
+    if (!statsfile.empty()) stats.WriteJson(statsfile, "Assembler", "words");
 
     return 0;
-}
\ No newline at end of file
+}
+#endif
@@ -0,0 +1,118 @@
+// --stats of Assembler, VMtranslator and JackAnalyzer, and the stage timer of the 13 tools.
+// A tool that includes several of them includes this first, outside their namespaces
+#ifndef STATS_H
+#define STATS_H
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <utility>
+#include <iomanip>
+#include <chrono>
+#ifdef _WIN32
+// only for GetProcessMemoryInfo. The macros windows.h would leave with the names of the
+// tools' enumerators (Keyword::VOID, Segment::CONST, ...) are taken back
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <psapi.h>
+#undef VOID
+#undef TRUE
+#undef FALSE
+#undef CONST
+#undef THIS
+#undef DELETE
+#undef ERROR
+#undef IN
+#undef OUT
+#else
+#include <sys/resource.h>
+#endif
+
+using namespace std;
+
+// what a run did and how long each phase took, for --stats
+class Stats {
+private:
+    chrono::steady_clock::time_point last = chrono::steady_clock::now();
+    vector<pair<string, double> > phases; // milliseconds
+    vector<pair<string, long long> > counts, functions;
+
+    template <class T>
+    static T& Entry(vector<pair<string, T> >& entries, string name) {
+        for (auto& entry : entries)
+            if (entry.first == name) return entry.second;
+        entries.push_back({ name, T() });
+        return entries.back().second;
+    }
+
+    // kilobytes
+    static long long PeakMemory() {
+#ifdef _WIN32
+        PROCESS_MEMORY_COUNTERS pmc;
+        GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc));
+        return pmc.PeakWorkingSetSize / 1024;
+#else
+        rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        return usage.ru_maxrss;
+#endif
+    }
+public:
+    // the time since the last lap goes to phase
+    void Lap(string phase) {
+        auto now = chrono::steady_clock::now();
+        Entry(phases, phase) += chrono::duration<double, milli>(now - last).count();
+        last = now;
+    }
+
+    void Count(string name, long long n = 1) { Entry(counts, name) += n; }
+
+    void Function(string name, long long size) { Entry(functions, name) += size; }
+
+    void Print(ostream& os, string unit) {
+        double total = 0;
+        for (auto& [name, ms] : phases) {
+            os << left << setw(24) << name << fixed << setprecision(2) << ms << " ms" << endl;
+            total += ms;
+        }
+        os << left << setw(24) << "total" << fixed << setprecision(2) << total << " ms" << endl;
+        for (auto& [name, n] : counts) os << left << setw(24) << name << n << endl;
+        os << left << setw(24) << "peak_memory" << PeakMemory() << " KB" << endl;
+        for (auto& [name, n] : functions) os << left << setw(24) << name << n << " " << unit << endl;
+    }
+
+    void WriteJson(string filename, string tool, string unit) {
+        ofstream ofs(filename);
+        ofs << "{\"tool\": \"" << tool << "\", \"phases_ms\": {";
+        for (size_t i = 0; i < phases.size(); ++i)
+            ofs << (i ? ", " : "") << "\"" << phases[i].first << "\": " << fixed << setprecision(3) << phases[i].second;
+        ofs << "}, \"counts\": {";
+        for (size_t i = 0; i < counts.size(); ++i)
+            ofs << (i ? ", " : "") << "\"" << counts[i].first << "\": " << counts[i].second;
+        ofs << "}, \"peak_memory_kb\": " << PeakMemory() << ", \"function_unit\": \"" << unit << "\", \"functions\": {";
+        for (size_t i = 0; i < functions.size(); ++i)
+            ofs << (i ? ", " : "") << "\"" << functions[i].first << "\": " << functions[i].second;
+        ofs << "}}" << endl;
+    }
+};
+
+// milliseconds since the last lap
+class Stopwatch {
+private:
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+public:
+    double Lap() {
+        auto now = chrono::steady_clock::now();
+        double ms = chrono::duration<double, milli>(now - start).count();
+        start = now;
+        return ms;
+    }
+};
+
+#endif
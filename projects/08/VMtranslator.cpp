@@ -6,13 +6,65 @@
 #include <regex>
 #include <bitset>
 #include <map>
+#include <set>
+#include <vector>
+#include <sstream>
+#include <iomanip>
+#include <memory>
+#include <chrono>
+#include "../06/Stats.h"
 
 using namespace std;
 
 enum class Command {
 	C_ARITHMETIC, C_PUSH, C_POP,
 	C_LABEL, C_GOTO, C_IF,
-	C_FUNCTION, C_RETURN, C_CALL
+	C_FUNCTION, C_RETURN, C_CALL,
+	C_RETURN_VOID
+};
+
+// passes the assembly on and counts its instructions, per function label
+class InstructionCounter : public streambuf {
+private:
+	streambuf* out;
+	Stats& stats;
+	string line, function;
+	long long size = 0;
+
+	void EndLine() {
+		if (line.empty() || line[0] == '/') return;
+		if (line[0] != '(') {
+			++size;
+			return;
+		}
+		// labels inside a function all have a '$'
+		if (line.find('$') != string::npos) return;
+		EndFunction();
+		function = line.substr(1, line.size() - 2);
+	}
+protected:
+	int overflow(int c) override {
+		if (c == EOF) return c;
+		if (c == '\n') {
+			EndLine();
+			line.clear();
+		} else {
+			line.push_back(c);
+		}
+		return out->sputc(c);
+	}
+
+	int sync() override { return out->pubsync(); }
+public:
+	InstructionCounter(streambuf* out, Stats& stats) : out(out), stats(stats) {}
+
+	void EndFunction() {
+		stats.Count("instructions", size);
+		if (!function.empty()) stats.Function(function, size);
+		size = 0;
+	}
+
+	streambuf* Out() { return out; }
 };
 
 class Parser {
@@ -21,6 +73,7 @@ private:
 	string word, arg1;
 	Command commandtype;
 	int arg2;
+	int lines = 0, wordline = 0, commandline = 0;
 	smatch m;
 
 	void NextWord() {
@@ -29,6 +82,7 @@ private:
 
 		while (true) {
 			if (!getline(ifs, word)) return;
+			wordline = ++lines;
 			word = regex_replace(word, EX_FSPACE, "");
 			word = regex_replace(word, EX_COMMENT, "");
 			if (word.size()) break;
@@ -45,6 +99,7 @@ public:
 	void Advance() {
 		static regex MATCH_EXPR(R"(^(\S+)\s*(\S+)?\s*(\d+)?\s*$)");
 
+		commandline = wordline;
 		regex_match(word, m, MATCH_EXPR);
 		string ct = m[1].str();
 		commandtype = [&]() {
@@ -56,6 +111,7 @@ public:
 			if (ct == "function") return Command::C_FUNCTION;
 			if (ct == "call") return Command::C_CALL;
 			if (ct == "return") return Command::C_RETURN;
+			if (ct == "return-void") return Command::C_RETURN_VOID;
 			return Command::C_ARITHMETIC;
 		}();
 		arg1 = (commandtype == Command::C_ARITHMETIC ? ct : m[2].str());
@@ -68,13 +124,22 @@ public:
 	string Arg1() { return arg1; }
 
 	int Arg2() { return arg2; }
+
+	// in the .vm file, from 1
+	int Line() { return commandline; }
 };
 
 class CodeWriter {
 private:
-	ofstream ofs;
-	string filename, nowfunction = "";
+	ofstream file;
+	ostream& ofs;
+	string filename, outname, nowfunction = "", prefix = "";
 	int arithmeticnum = 0, returnaddress = 0;
+	bool compact = false; // call, return and comparisons jump to one shared copy
+	bool marks = false;   // "//@ file line function" in front of the code of each command
+	set<string> routines; // the shared routines jumped to so far
+	string dholds = ""; // "segment index" whose value the last command left in D
+	unique_ptr<InstructionCounter> counter;
 	smatch m;
 
 	void PushDToStack() {
@@ -91,11 +156,143 @@ private:
 			<< "D=M" << endl;
 	}
 
+	void Mark(string file, int line, string function) {
+		if (marks) ofs << "//@ " << file << " " << line << " " << function << endl;
+	}
+
 	string GetLabel(string beforelabel) {
 		return nowfunction + "$" + beforelabel;
 	}
+
+	// labels of the shared routines, internal to this output like the other '$' labels
+	string Routine(string name) {
+		routines.insert(name);
+		return "$" + prefix + name + "$";
+	}
+
+	// D holds the return address of whoever jumped here. A program that runs off its end stops in front of them
+	void WriteRoutines() {
+		static vector<string> CALL_VIRTUAL = { "@LCL", "@ARG", "@THIS", "@THAT" };
+
+		if (routines.empty()) return;
+		set<string> used = routines;
+		Mark("-", 0, "(halt)");
+		ofs << "(" << Routine("END") << ")" << endl
+			<< "@" << Routine("END") << endl
+			<< "0;JMP" << endl;
+
+		if (used.count("CALL")) {
+			// R13 = number of arguments, R14 = function
+			Mark("-", 0, "(call)");
+			ofs << "(" << Routine("CALL") << ")" << endl;
+			PushDToStack();
+			for (auto& symbol : CALL_VIRTUAL) {
+				ofs << symbol << endl
+					<< "D=M" << endl;
+				PushDToStack();
+			}
+			ofs << "@SP" << endl
+				<< "D=M" << endl
+				<< "@LCL" << endl
+				<< "M=D" << endl
+				<< "@R13" << endl
+				<< "D=D-M" << endl
+				<< "@5" << endl
+				<< "D=D-A" << endl
+				<< "@ARG" << endl
+				<< "M=D" << endl
+				<< "@R14" << endl
+				<< "A=M" << endl
+				<< "0;JMP" << endl;
+		}
+		if (used.count("RETURN")) {
+			Mark("-", 0, "(return)");
+			ofs << "(" << Routine("RETURN") << ")" << endl;
+			WriteReturnBody(true);
+		}
+		if (used.count("RETURN_VOID")) {
+			Mark("-", 0, "(return)");
+			ofs << "(" << Routine("RETURN_VOID") << ")" << endl;
+			WriteReturnBody(false);
+		}
+		for (string name : { "EQ", "GT", "LT" }) {
+			if (!used.count(name)) continue;
+			Mark("-", 0, "(compare)");
+			ofs << "(" << Routine(name) << ")" << endl
+				<< "@R15" << endl
+				<< "M=D" << endl
+				<< "@SP" << endl
+				<< "AM=M-1" << endl
+				<< "D=M" << endl
+				<< "A=A-1" << endl
+				<< "D=M-D" << endl
+				<< "M=-1" << endl
+				<< "@" << Routine(name + "_TRUE") << endl
+				<< "D;J" << name << endl
+				<< "@SP" << endl
+				<< "A=M-1" << endl
+				<< "M=0" << endl
+				<< "(" << Routine(name + "_TRUE") << ")" << endl
+				<< "@R15" << endl
+				<< "A=M" << endl
+				<< "0;JMP" << endl;
+		}
+	}
+
+	void WriteReturnBody(bool hasvalue) {
+		static vector<pair<int, string> > RETURN_VIRTUAL = { {1,"@THAT"}, {2,"@THIS"}, {3,"@ARG"}, {4,"@LCL"} };
+
+		ofs << "@LCL" << endl
+			<< "D=M" << endl
+			<< "@R13" << endl
+			<< "M=D" << endl
+			<< "@5" << endl
+			<< "D=D-A" << endl
+			<< "A=D" << endl
+			<< "D=M" << endl
+			<< "@R14" << endl
+			<< "M=D" << endl;
+		if (hasvalue) {
+			PopDFromStack();
+			ofs << "@ARG" << endl
+				<< "A=M" << endl
+				<< "M=D" << endl
+				<< "D=A+1" << endl
+				<< "@SP" << endl
+				<< "M=D" << endl;
+		} else {
+			ofs << "@ARG" << endl
+				<< "D=M" << endl
+				<< "@SP" << endl
+				<< "M=D" << endl;
+		}
+		for (auto& itersymbol : RETURN_VIRTUAL) {
+			int i = itersymbol.first;
+			string symbol = itersymbol.second;
+
+			ofs << "@R13" << endl
+				<< "D=M" << endl
+				<< "@" << i << endl
+				<< "D=D-A" << endl
+				<< "A=D" << endl
+				<< "D=M" << endl
+				<< symbol << endl
+				<< "M=D" << endl;
+		}
+		ofs << "@R14" << endl
+			<< "A=M" << endl
+			<< "0;JMP" << endl;
+	}
+
+	static string BaseSymbol(string segment) {
+		if (segment == "local") return "@LCL";
+		if (segment == "argument") return "@ARG";
+		if (segment == "this") return "@THIS";
+		return "@THAT";
+	}
 public:
-	CodeWriter(string filename) {
+	CodeWriter(ostream& out) : ofs(out) {}
+	CodeWriter(string filename) : ofs(file) {
 		if (filename.substr(filename.size() - 3) == ".vm") {
 			filename = filename.substr(0, filename.size() - 3);
 		} else {
@@ -104,10 +301,42 @@ public:
 			filename += m[1].str();
 		}
 
-		ofs.open(filename + ".asm");
+		outname = filesystem::path(filename).filename().string();
+		file.open(filename + ".asm");
+	}
+
+	// counts everything written from now on into stats
+	void CountInstructions(Stats& stats) {
+		counter = make_unique<InstructionCounter>(ofs.rdbuf(), stats);
+		ofs.rdbuf(counter.get());
+	}
+
+	// smaller code for programs that would not fit in ROM, a few instructions slower per call
+	void Compact() { compact = true; }
+
+	// comments Assembler --map turns into a map from ROM addresses to VM lines
+	void SourceMarks() { marks = true; }
+
+	// goes in front of each command; function is the one the command is in (or starts)
+	void WriteMark(int line, string function) { Mark(filename, line, function); }
+
+	// a library is linked next to other code, so its internal labels get a prefix
+	void WriteLibraryHeader(vector<string> classnames) {
+		prefix = outname + ".";
+		ofs << "// library";
+		for (auto& classname : classnames) ofs << " " << classname;
+		ofs << endl;
+	}
+
+	void WriteLibrary(string filename) {
+		dholds = "";
+		ifstream ifs(filename);
+		Mark("-", 0, "(library)");
+		ofs << ifs.rdbuf();
 	}
 
 	void SetFileName(string filename) {
+		dholds = "";
 		static regex EX_FILENAME(R"([^/]+$)");
 
 		regex_search(filename, m, EX_FILENAME);
@@ -115,6 +344,7 @@ public:
 	}
 
 	void WriteInit() {
+		Mark("-", 0, "(boot)");
 		ofs << "@256" << endl
 			<< "D=A" << endl
 			<< "@SP" << endl
@@ -123,6 +353,16 @@ public:
 	}
 
 	void WriteArithmetic(string command) {
+		dholds = "";
+		if ((command == "eq" || command == "gt" || command == "lt") && compact) {
+			string label = "$" + prefix + "ARITHMETIC_IF_" + to_string(arithmeticnum++) + "$";
+			ofs << "@" << label << endl
+				<< "D=A" << endl
+				<< "@" << Routine(command == "eq" ? "EQ" : command == "gt" ? "GT" : "LT") << endl
+				<< "0;JMP" << endl
+				<< "(" << label << ")" << endl;
+			return;
+		}
 		ofs << "@SP" << endl;
 		if (command == "neg" || command == "not") {
 			ofs << "D=M-1" << endl
@@ -135,7 +375,7 @@ public:
 				<< "A=A-1" << endl;
 			if (command == "eq" || command == "gt" || command == "lt") {
 				ofs << "D=M-D" << endl
-					<< "@$ARITHMETIC_IF_" << arithmeticnum << "$" << endl;
+					<< "@$" << prefix << "ARITHMETIC_IF_" << arithmeticnum << "$" << endl;
 				ofs << [&]() {
 					if (command == "eq") return "D;JEQ";
 					if (command == "gt") return "D;JGT";
@@ -144,48 +384,50 @@ public:
 				ofs << "@SP" << endl
 					<< "A=M-1" << endl
 					<< "M=0" << endl
-					<< "@$ARITHMETIC_ENDIF_" << arithmeticnum << "$" << endl
+					<< "@$" << prefix << "ARITHMETIC_ENDIF_" << arithmeticnum << "$" << endl
 					<< "0;JMP" << endl
-					<< "($ARITHMETIC_IF_" << arithmeticnum << "$)" << endl
+					<< "($" << prefix << "ARITHMETIC_IF_" << arithmeticnum << "$)" << endl
 					<< "@SP" << endl
 					<< "A=M-1" << endl
 					<< "M=-1" << endl
-					<< "($ARITHMETIC_ENDIF_" << arithmeticnum << "$)" << endl;
+					<< "($" << prefix << "ARITHMETIC_ENDIF_" << arithmeticnum << "$)" << endl;
 				++arithmeticnum;
 			} else {
 				ofs << [&]() {
 					if (command == "add") return "M=M+D";
 					if (command == "sub") return "M=M-D";
 					if (command == "and") return "M=M&D";
-					cout << command << endl;
 					return "M=M|D";
 				}() << endl;
 			}
 		}
 	}
 
+	// every push and pop leaves the value in D, so pushing it again right away needs no load
 	void WritePushPop(Command command, string segment, int index) {
+		string slot = segment + " " + to_string(index);
 		if (command == Command::C_PUSH) {
-			if (segment == "static") {
+			if (slot == dholds) {
+				// D already holds it
+			} else if (segment == "static") {
 				ofs << "@" << filename << "." << index << endl
 					<< "D=M" << endl;
 			} else if (segment == "pointer" || segment == "temp") {
 				ofs << "@" << index + (segment == "pointer" ? 3 : 5) << endl;
 				ofs << "D=M" << endl;
-			} else {
+			} else if (segment == "constant") {
 				ofs << "@" << index << endl
 					<< "D=A" << endl;
-				if (segment != "constant") {
-					string symbol = [&]() {
-						if (segment == "local") return "@LCL";
-						if (segment == "argument") return "@ARG";
-						if (segment == "this") return "@THIS";
-						return "@THAT";
-					}();
-					ofs << symbol << endl;
-					ofs << "A=M+D" << endl
-						<< "D=M" << endl;
-				}
+			} else if (index <= 1) {
+				ofs << BaseSymbol(segment) << endl
+					<< (index ? "A=M+1" : "A=M") << endl
+					<< "D=M" << endl;
+			} else {
+				ofs << "@" << index << endl
+					<< "D=A" << endl
+					<< BaseSymbol(segment) << endl
+					<< "A=M+D" << endl
+					<< "D=M" << endl;
 			}
 			PushDToStack();
 		} else {
@@ -197,39 +439,42 @@ public:
 				PopDFromStack();
 				ofs << "@" << index + (segment == "pointer" ? 3 : 5) << endl
 					<< "M=D" << endl;
+			} else if (index <= 5) {
+				// stepping A up is shorter than computing the address first
+				PopDFromStack();
+				ofs << BaseSymbol(segment) << endl
+					<< "A=M" << endl;
+				for (int i = 0; i < index; ++i) ofs << "A=A+1" << endl;
+				ofs << "M=D" << endl;
 			} else {
-				string symbol = [&]() {
-					if (segment == "local") return "@LCL";
-					if (segment == "argument") return "@ARG";
-					if (segment == "this") return "@THIS";
-					return "@THAT";
-				}();
 				ofs << "@" << index << endl
 					<< "D=A" << endl
-					<< symbol << endl
-					<< "M=M+D" << endl;
+					<< BaseSymbol(segment) << endl
+					<< "D=M+D" << endl
+					<< "@R13" << endl
+					<< "M=D" << endl;
 				PopDFromStack();
-				ofs << symbol << endl
+				ofs << "@R13" << endl
 					<< "A=M" << endl
-					<< "M=D" << endl
-					<< "@" << index << endl
-					<< "D=A" << endl
-					<< symbol << endl
-					<< "M=M-D" << endl;
+					<< "M=D" << endl;
 			}
 		}
+		dholds = slot;
 	}
 
 	void WriteLabel(string label) {
+		dholds = "";
 		ofs << "(" << GetLabel(label) << ")" << endl;
 	}
 
 	void WriteGoto(string label) {
+		dholds = "";
 		ofs << "@" << GetLabel(label) << endl
 			<< "0;JMP" << endl;
 	}
 
 	void WriteIf(string label) {
+		dholds = "";
 		ofs << "@SP" << endl
 			<< "M=M-1" << endl
 			<< "A=M" << endl
@@ -239,9 +484,33 @@ public:
 	}
 
 	void WriteCall(string functionname, int numargs) {
+		dholds = "";
 		static vector<string> CALL_VIRTUAL = { "@LCL", "@ARG", "@THIS", "@THAT" };
 
-		ofs << "@$RETURN_ADDRESS_" << returnaddress << "$" << endl
+		if (compact) {
+			if (numargs <= 1) {
+				ofs << "@R13" << endl
+					<< "M=" << numargs << endl;
+			} else {
+				ofs << "@" << numargs << endl
+					<< "D=A" << endl
+					<< "@R13" << endl
+					<< "M=D" << endl;
+			}
+			ofs << "@" << functionname << endl
+				<< "D=A" << endl
+				<< "@R14" << endl
+				<< "M=D" << endl
+				<< "@$" << prefix << "RETURN_ADDRESS_" << returnaddress << "$" << endl
+				<< "D=A" << endl
+				<< "@" << Routine("CALL") << endl
+				<< "0;JMP" << endl
+				<< "($" << prefix << "RETURN_ADDRESS_" << returnaddress << "$)" << endl;
+			++returnaddress;
+			return;
+		}
+
+		ofs << "@$" << prefix << "RETURN_ADDRESS_" << returnaddress << "$" << endl
 			<< "D=A" << endl;
 		PushDToStack();
 		for (auto& symbol : CALL_VIRTUAL) {
@@ -261,80 +530,126 @@ public:
 			<< "M=D" << endl
 			<< "@" << functionname << endl
 			<< "0;JMP" << endl
-			<< "($RETURN_ADDRESS_" << returnaddress << "$)" << endl;
+			<< "($" << prefix << "RETURN_ADDRESS_" << returnaddress << "$)" << endl;
 		++returnaddress;
 	}
 
-	void WriteReturn() {
-		static vector<pair<int, string> > RETURN_VIRTUAL = { {1,"@THAT"}, {2,"@THIS"}, {3,"@ARG"}, {4,"@LCL"} };
-
-		ofs << "@LCL" << endl
-			<< "D=M" << endl
-			<< "@R13" << endl
-			<< "M=D" << endl
-			<< "@5" << endl
-			<< "D=D-A" << endl
-			<< "A=D" << endl
-			<< "D=M" << endl
-			<< "@R14" << endl
-			<< "M=D" << endl;
-		PopDFromStack();
-		ofs << "@ARG" << endl
-			<< "A=M" << endl
-			<< "M=D" << endl
-			<< "D=A+1" << endl
-			<< "@SP" << endl
-			<< "M=D" << endl;
-		for (auto& itersymbol : RETURN_VIRTUAL) {
-			int i = itersymbol.first;
-			string symbol = itersymbol.second;
-
-			ofs << "@R13" << endl
-				<< "D=M" << endl
-				<< "@" << i << endl
-				<< "D=D-A" << endl
-				<< "A=D" << endl
-				<< "D=M" << endl
-				<< symbol << endl
-				<< "M=D" << endl;
+	// return-void: the caller expects no value, so SP goes back to ARG
+	void WriteReturn(bool hasvalue = true) {
+		dholds = "";
+		if (compact) {
+			ofs << "@" << Routine(hasvalue ? "RETURN" : "RETURN_VOID") << endl
+				<< "0;JMP" << endl;
+			return;
 		}
-		ofs << "@R14" << endl
-			<< "A=M" << endl
-			<< "0;JMP" << endl;
+		WriteReturnBody(hasvalue);
 	}
 
 	void WriteFunction(string functionname, int numlocals) {
+		dholds = "";
 		nowfunction = functionname;
 		ofs << "(" << functionname << ")" << endl
 			<< "D=0" << endl;
 		for (int i = 0; i < numlocals; ++i) PushDToStack();
 	}
 
-	void close() { ofs.close(); }
+	// the shared routines go last, where nothing falls into them
+	void close() {
+		if (compact) {
+			WriteRoutines();
+			compact = false;
+		}
+		if (counter) {
+			ofs.flush();
+			counter->EndFunction();
+			ofs.rdbuf(counter->Out());
+			counter.reset();
+		}
+		file.close();
+	}
 };
 
+vector<string> LibraryClasses(string filename) {
+	ifstream ifs(filename);
+	string word;
+	vector<string> classnames;
+	ifs >> word >> word;
+	if (word != "library") return classnames;
+	getline(ifs, word);
+	stringstream ss(word);
+	while (ss >> word) classnames.push_back(word);
+	return classnames;
+}
+
+#ifndef NO_MAIN
 int main(int argc, char** argv) {
-	string filename = argv[1];
+	string filename, library, statsfile, bootfile;
+	bool makelibrary = false, printstats = false, compact = false, map = false;
+	for (int i = 1; i < argc; ++i) {
+		string arg = argv[i];
+		if (arg == "--lib") makelibrary = true;
+		else if (arg == "--compact") compact = true;
+		else if (arg == "--map") map = true;
+		else if (arg == "--boot" && i + 1 < argc) bootfile = argv[++i];
+		else if (arg == "--os" && i + 1 < argc) library = argv[++i];
+		else if (arg == "--stats") printstats = true;
+		else if (arg.rfind("--stats=", 0) == 0) statsfile = arg.substr(8);
+		else filename = arg;
+	}
+	// only the bootstrap and, with --compact, the routines its call goes through, for linking
+	// separately translated classes (13 HackLink)
+	if (!bootfile.empty()) {
+		ofstream ofs(bootfile);
+		CodeWriter cw(ofs);
+		if (compact) cw.Compact();
+		cw.WriteInit();
+		cw.close();
+		return 0;
+	}
 
-	vector<string> files;
+	Stats stats;
+	bool counting = printstats || !statsfile.empty();
+
+	vector<string> files, libraryclasses;
+	if (!library.empty()) libraryclasses = LibraryClasses(library);
 
 	namespace fs = filesystem;
 	if (fs::is_directory(filename)) {
-		for (auto& p : fs::directory_iterator(filename))
-			if (p.path().extension() == ".vm")
-				files.push_back(p.path().string());
+		for (auto& p : fs::directory_iterator(filename)) {
+			if (p.path().extension() != ".vm") continue;
+			// old projects still carry copies of the OS classes
+			if (count(libraryclasses.begin(), libraryclasses.end(), p.path().stem().string())) continue;
+			files.push_back(p.path().string());
+		}
 	} else {
 		files.push_back(filename);
 	}
+	sort(files.begin(), files.end());
 
 	CodeWriter cw(filename);
-	cw.WriteInit();
+	if (compact) cw.Compact();
+	if (map) cw.SourceMarks();
+	if (counting) {
+		cw.CountInstructions(stats);
+		stats.Lap("setup");
+	}
+	if (makelibrary) {
+		vector<string> classnames;
+		for (auto& file : files) classnames.push_back(fs::path(file).stem().string());
+		cw.WriteLibraryHeader(classnames);
+	} else {
+		cw.WriteInit();
+	}
 
 	for (auto& file : files) {
 		Parser ps(file);
 		cw.SetFileName(file);
+		string function;
 		while (ps.HasMoreCommands()) {
 			ps.Advance();
+			if (counting) stats.Count("vm_commands");
+			if (ps.CommandType() == Command::C_FUNCTION) function = ps.Arg1();
+			cw.WriteMark(ps.Line(), function);
 			switch (ps.CommandType()) {
 			case Command::C_ARITHMETIC:
 				cw.WriteArithmetic(ps.Arg1());
@@ -355,6 +670,9 @@ int main(int argc, char** argv) {
 			case Command::C_RETURN:
 				cw.WriteReturn();
 				break;
+			case Command::C_RETURN_VOID:
+				cw.WriteReturn(false);
+				break;
 			case Command::C_FUNCTION:
 				cw.WriteFunction(ps.Arg1(), ps.Arg2());
 				break;
@@ -364,7 +682,20 @@ int main(int argc, char** argv) {
 			}
 		}
 	}
+	if (counting) {
+		stats.Count("files", files.size());
+		stats.Lap("translate");
+	}
+	if (!library.empty()) {
+		cw.WriteLibrary(library);
+		if (counting) stats.Lap("library");
+	}
 	cw.close();
+	if (counting) stats.Lap("write");
+
+	if (printstats) stats.Print(cout, "words");
+	if (!statsfile.empty()) stats.WriteJson(statsfile, "VMtranslator", "words");
 
 	return 0;
-}
\ No newline at end of file
+}
+#endif
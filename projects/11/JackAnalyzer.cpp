@@ -1,13 +1,36 @@
 #include <iostream>
 #include <fstream>
 #include <filesystem>
+#include <algorithm>
 #include <string>
+#include <vector>
 #include <map>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <string_view>
+#include <cstring>
 #include <utility>
 #include <tuple>
+#include <sstream>
+#include <iomanip>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <array>
+#include <chrono>
+#include <mutex>
+#include <condition_variable>
+#include <queue>
+#include <stdexcept>
+#include "../06/Stats.h"
 
 using namespace std;
 
+// bump whenever the generated code changes, it is part of the cache key
+const string COMPILER_VERSION = "11.7";
+
 enum class Token {
 	KEYWORD, SYMBOL, IDENTIFIER, INT_CONST, STRING_CONST
 };
@@ -31,12 +54,111 @@ enum class Command {
 	ADD, SUB, NEG, EQ, GT, LT, AND, OR, NOT
 };
 
+struct Options {
+	bool poolstrings = false; // build each string literal once into a static
+	string cachedir = "";     // reuse outputs of unchanged classes
+	bool wholeprogram = false; // void subroutines return no value
+	bool pipeline = false;     // tokenize on a second thread
+	Stats* stats = nullptr;    // collects --stats
+	bool quiet = false;        // nothing on stdout, it carries --serve responses
+	bool intext = false;       // the .vm and .xml are only made as text, see VmText()
+};
+
+// what the engine knows about the other classes compiled with it
+struct Program {
+	vector<string> classnames;
+	set<string, less<> > voids; // "Class.subroutine", only with Options::wholeprogram
+};
+
+// identifiers, labels and qualified names of one compilation unit, each stored once in
+// large blocks; the views it hands out stay valid as long as the pool
+class StringPool {
+private:
+	static const size_t BLOCK = 1 << 16;
+	vector<unique_ptr<char[]> > blocks;
+	size_t used = BLOCK; // in the last block
+	unordered_set<string_view> names;
+	char buffer[64];
+public:
+	StringPool() {}
+	StringPool(const StringPool&) = delete;
+
+	string_view Intern(string_view str) {
+		auto it = names.find(str);
+		if (it != names.end()) return *it;
+		if (used + str.size() > BLOCK) {
+			blocks.emplace_back(new char[max(BLOCK, str.size())]);
+			used = 0;
+		}
+		char* p = blocks.back().get() + used;
+		memcpy(p, str.data(), str.size());
+		used += str.size();
+		return *names.insert(string_view(p, str.size())).first;
+	}
+
+	// "classname.subroutinename"
+	string_view Join(string_view classname, string_view subroutinename) {
+		if (classname.size() + subroutinename.size() + 1 > sizeof(buffer))
+			return Intern(string(classname) + "." + string(subroutinename));
+		memcpy(buffer, classname.data(), classname.size());
+		buffer[classname.size()] = '.';
+		memcpy(buffer + classname.size() + 1, subroutinename.data(), subroutinename.size());
+		return Intern(string_view(buffer, classname.size() + subroutinename.size() + 1));
+	}
+
+	string_view Label(int number) {
+		int size = snprintf(buffer, sizeof(buffer), "LABEL_%d", number);
+		return Intern(string_view(buffer, size));
+	}
+};
+
+struct TokenRecord {
+	Token type;
+	Keyword keyword;
+	bool more; // HasMoreTokens() after this token
+	string word;
+};
+
+// single producer single consumer ring, the producer gives up once Stop() is called
+class TokenRing {
+private:
+	static const size_t SIZE = 4096;
+	array<TokenRecord, SIZE> records;
+	atomic<size_t> head{ 0 }, tail{ 0 };
+	atomic<bool> stopped{ false };
+public:
+	bool Push(TokenRecord&& record) {
+		size_t t = tail.load(memory_order_relaxed);
+		while (t - head.load(memory_order_acquire) == SIZE) {
+			if (stopped.load(memory_order_relaxed)) return false;
+			this_thread::yield();
+		}
+		records[t % SIZE] = move(record);
+		tail.store(t + 1, memory_order_release);
+		return true;
+	}
+
+	TokenRecord Pop() {
+		size_t h = head.load(memory_order_relaxed);
+		while (tail.load(memory_order_acquire) == h) this_thread::yield();
+		TokenRecord record = move(records[h % SIZE]);
+		head.store(h + 1, memory_order_release);
+		return record;
+	}
+
+	void Stop() { stopped.store(true, memory_order_relaxed); }
+};
+
 class JackTokenizer {
 private:
 	ifstream ifs;
 	string word;
 	Token tokentype;
 	Keyword keyword;
+	bool more = true;
+	int tokens = 0;
+	shared_ptr<TokenRing> ring;
+	thread producer;
 
 	void SkipSpace() {
 		while (isspace(ifs.get()));
@@ -90,16 +212,8 @@ private:
 		}
 		SkipSpace();
 	}
-public:
-	JackTokenizer() {}
-	JackTokenizer(string filename) {
-		ifs.open(filename, ios::in);
-		Advance();
-	}
 
-	bool HasMoreTokens() { return !ifs.eof(); }
-
-	void Advance() {
+	void Scan() {
 		const static vector<pair<Keyword, string> > keywords = {
 			{Keyword::CLASS, "class"},
 			{Keyword::CONSTRUCTOR, "constructor"},
@@ -125,7 +239,7 @@ public:
 		};
 
 		NextWord();
-		for (auto [key, str] : keywords) {
+		for (auto& [key, str] : keywords) {
 			if (word == str) {
 				tokentype = Token::KEYWORD;
 				keyword = key;
@@ -147,53 +261,118 @@ public:
 		}
 		tokentype = Token::IDENTIFIER;
 	}
+public:
+	JackTokenizer() {}
+	JackTokenizer(string filename, bool pipeline = false) {
+		if (!pipeline) {
+			ifs.open(filename, ios::in);
+			Advance();
+			return;
+		}
+		ring = make_shared<TokenRing>();
+		producer = thread([ring = ring, source = JackTokenizer(filename)]() mutable {
+			while (true) {
+				bool more = source.HasMoreTokens();
+				if (!ring->Push({ source.tokentype, source.keyword, more, source.word }) || !more) break;
+				source.Advance();
+			}
+		});
+		Advance();
+	}
+	JackTokenizer(JackTokenizer&&) = default;
+	JackTokenizer& operator=(JackTokenizer&&) = default;
+
+	~JackTokenizer() {
+		if (!producer.joinable()) return;
+		ring->Stop();
+		producer.join();
+	}
+
+	// unget() at the end clears eofbit but leaves failbit
+	bool HasMoreTokens() { return ring ? more : ifs.good(); }
+
+	void Advance() {
+		if (!ring) {
+			tokens += ifs.good();
+			Scan();
+			return;
+		}
+		if (!more) return;
+		++tokens;
+		TokenRecord record = ring->Pop();
+		tokentype = record.type;
+		keyword = record.keyword;
+		more = record.more;
+		word = move(record.word);
+	}
+
+	// read so far
+	int Tokens() { return tokens; }
 
 	Token TokenType() { return tokentype; }
 
 	Keyword KeyWord() { return keyword; }
 
-	string Symbol() {
+	// the views are only good until the next Advance()
+	string_view Symbol() {
 		if (word == "<") return "&lt;";
 		if (word == ">") return "&gt;";
 		if (word == "&") return "&amp;";
 		return word;
 	}
 
-	string Identifier() { return word; }
+	string_view Identifier() { return word; }
 
 	int IntVal() { return stoi(word); }
 
-	string StringVal() { return word.substr(1, word.size() - 2); }
+	string_view StringVal() { return string_view(word).substr(1, word.size() - 2); }
+};
+
+struct Symbol {
+	Kind kind;
+	int type; // id from SymbolTable::TypeId
+	int index;
 };
 
 class SymbolTable {
 private:
 	int staticcnt, fieldcnt, argcnt, varcnt;
-	map<string, tuple<Kind, string, int> > classtable, subroutinetable;
+	// both scopes share one table, class entries hidden by the subroutine are kept aside;
+	// names and types are interned by the engine and outlive the table
+	unordered_map<string_view, Symbol> symbols;
+	vector<string_view> subroutinenames;
+	vector<pair<string_view, Symbol> > shadowed;
+	vector<string_view> types;
+	unordered_map<string_view, int> typeids;
 public:
 	SymbolTable() {
 		staticcnt = fieldcnt = argcnt = varcnt = 0;
 	}
 
 	void StartSubroutine() {
-		subroutinetable.clear();
+		for (auto& name : subroutinenames) symbols.erase(name);
+		for (auto& [name, symbol] : shadowed) symbols[name] = symbol;
+		subroutinenames.clear();
+		shadowed.clear();
 		argcnt = varcnt = 0;
 	}
 
-	void Define(string name, string type, Kind kind) {
-		if (kind == Kind::STATIC) {
-			classtable[name] = tuple(kind, type, staticcnt);
-			++staticcnt;
-		} else if(kind == Kind::FIELD) {
-			classtable[name] = tuple(kind, type, fieldcnt);
-			++fieldcnt;
-		} else if (kind == Kind::ARG) {
-			subroutinetable[name] = tuple(kind, type, argcnt);
-			++argcnt;
-		} else {
-			subroutinetable[name] = tuple(kind, type, varcnt);
-			++varcnt;
+	void Define(string_view name, string_view type, Kind kind) {
+		Symbol symbol = { kind, TypeId(type), 0 };
+		if (kind == Kind::STATIC) symbol.index = staticcnt++;
+		else if (kind == Kind::FIELD) symbol.index = fieldcnt++;
+		else if (kind == Kind::ARG) symbol.index = argcnt++;
+		else symbol.index = varcnt++;
+
+		if (kind == Kind::ARG || kind == Kind::VAR) {
+			auto it = symbols.find(name);
+			if (it == symbols.end()) subroutinenames.push_back(name);
+			else if (it->second.kind == Kind::STATIC || it->second.kind == Kind::FIELD) {
+				shadowed.emplace_back(name, it->second);
+				subroutinenames.push_back(name);
+			}
 		}
+		symbols[name] = symbol;
 	}
 
 	int VarCount(Kind kind) {
@@ -203,28 +382,40 @@ public:
 		return varcnt;
 	}
 
-	Kind KindOf(string name) {
-		if (subroutinetable.count(name)) return get<0>(subroutinetable[name]);
-		if (classtable.count(name)) return get<0>(classtable[name]);
-		return Kind::NONE;
+	// nullptr when the name isn't a variable (a class or subroutine name)
+	const Symbol* Find(string_view name) {
+		auto it = symbols.find(name);
+		return it == symbols.end() ? nullptr : &it->second;
 	}
 
-	string TypeOf(string name) {
-		if (subroutinetable.count(name)) return get<1>(subroutinetable[name]);
-		if (classtable.count(name)) return get<1>(classtable[name]);
+	int TypeId(string_view type) {
+		auto [it, inserted] = typeids.emplace(type, types.size());
+		if (inserted) types.push_back(type);
+		return it->second;
 	}
 
-	int IndexOf(string name) {
-		if (subroutinetable.count(name)) return get<2>(subroutinetable[name]);
-		if (classtable.count(name)) return get<2>(classtable[name]);
-	}
+	string_view TypeName(int type) { return types[type]; }
+};
+
+enum class VMOp {
+	PUSH, POP, ARITHMETIC, LABEL, GOTO, IF, CALL, FUNCTION, RETURN, RETURN_VOID
+};
+
+struct VMCommand {
+	VMOp op;
+	Segment segment;
+	Command command;
+	string_view name; // label or function, literal or from the engine's StringPool
+	int index;   // segment index, nargs or nlocals
 };
 
 class VMWriter {
 private:
-	ofstream ofs;
-
-	string Segtostr(Segment segment) {
+	string filename;
+	vector<VMCommand> commands;
+	size_t unoptimized = 0;
+public:
+	static string Segtostr(Segment segment) {
 		if (segment == Segment::CONST) return "constant";
 		if (segment == Segment::ARG) return "argument";
 		if (segment == Segment::LOCAL) return "local";
@@ -234,71 +425,364 @@ private:
 		if (segment == Segment::POINTER) return "pointer";
 		return "temp";
 	}
+
+	static string Comtostr(Command command) {
+		if (command == Command::ADD) return "add";
+		if (command == Command::SUB) return "sub";
+		if (command == Command::NEG) return "neg";
+		if (command == Command::EQ) return "eq";
+		if (command == Command::GT) return "gt";
+		if (command == Command::LT) return "lt";
+		if (command == Command::AND) return "and";
+		if (command == Command::OR) return "or";
+		return "not";
+	}
+private:
+	// what pointer 0 (THIS) or pointer 1 (THAT) is known to hold: the value of "segment index"
+	struct Held {
+		bool known = false;
+		Segment segment = Segment::CONST;
+		int index = 0;
+
+		bool operator==(const Held& h) const {
+			return known == h.known && (!known || (segment == h.segment && index == h.index));
+		}
+	};
+
+	// the state at a command, or unreached while the analysis has not got there yet
+	struct Pointers {
+		bool reached = false;
+		Held held[2];
+
+		void Meet(const Pointers& p) {
+			if (!p.reached) return;
+			if (!reached) {
+				*this = p;
+				return;
+			}
+			for (int i = 0; i < 2; ++i)
+				if (!(held[i] == p.held[i])) held[i].known = false;
+		}
+
+		bool operator==(const Pointers& p) const {
+			return reached == p.reached && held[0] == p.held[0] && held[1] == p.held[1];
+		}
+	};
+
+	// "push x; pop pointer p", returns p or -1
+	static int SetPointer(const vector<VMCommand>& cs, size_t i) {
+		if (i + 1 >= cs.size() || cs[i].op != VMOp::PUSH ||
+			cs[i].segment == Segment::CONST || cs[i].segment == Segment::POINTER) return -1;
+		const VMCommand& c = cs[i + 1];
+		if (c.op != VMOp::POP || c.segment != Segment::POINTER) return -1;
+		return c.index;
+	}
+
+	// forgets everything read through the pointer that now holds something else
+	static void Moved(Pointers& p, int pointer) {
+		Segment segment = pointer ? Segment::THAT : Segment::THIS;
+		for (auto& h : p.held)
+			if (h.segment == segment) h.known = false;
+	}
+
+	// steps over commands[i], and over i + 1 too if they set a pointer; jumps go to labels
+	static size_t Step(const vector<VMCommand>& function, size_t i, Pointers& p, map<string_view, Pointers>& labels) {
+		const VMCommand& c = function[i];
+		int pointer = SetPointer(function, i);
+		if (pointer >= 0) {
+			Held& h = p.held[pointer];
+			h.known = c.segment != (pointer ? Segment::THAT : Segment::THIS);
+			h.segment = c.segment;
+			h.index = c.index;
+			Moved(p, pointer);
+			return i + 2;
+		}
+		switch (c.op) {
+		case VMOp::POP:
+			for (auto& h : p.held) {
+				if (h.segment == c.segment && h.index == c.index) h.known = false;
+				// a field or an array element may be any other one
+				if ((c.segment == Segment::THIS || c.segment == Segment::THAT) &&
+					(h.segment == Segment::THIS || h.segment == Segment::THAT)) h.known = false;
+			}
+			if (c.segment == Segment::POINTER) {
+				p.held[c.index].known = false;
+				Moved(p, c.index);
+			}
+			break;
+		case VMOp::CALL:
+			// the callee gives THIS and THAT back, but it may change memory and statics
+			for (auto& h : p.held)
+				if (h.segment != Segment::LOCAL && h.segment != Segment::ARG) h.known = false;
+			break;
+		case VMOp::LABEL:
+			p.Meet(labels[c.name]);
+			break;
+		case VMOp::GOTO:
+			labels[c.name].Meet(p);
+			p = Pointers();
+			break;
+		case VMOp::IF:
+			labels[c.name].Meet(p);
+			break;
+		case VMOp::FUNCTION:
+			p = Pointers();
+			p.reached = true;
+			break;
+		case VMOp::RETURN:
+		case VMOp::RETURN_VOID:
+			p = Pointers();
+			break;
+		default:
+			break;
+		}
+		return i + 1;
+	}
+
+	// drops "push x; pop pointer 0|1" when the pointer is known to hold x already,
+	// following jumps, and across calls for locals and arguments
+	static void ReusePointers(vector<VMCommand>& function) {
+		map<string_view, Pointers> labels, before;
+		do {
+			before = labels;
+			Pointers p;
+			for (size_t i = 0; i < function.size(); i = Step(function, i, p, labels));
+		} while (!(labels == before));
+
+		vector<VMCommand> res;
+		res.reserve(function.size());
+		Pointers p;
+		for (size_t i = 0; i < function.size(); ) {
+			int pointer = SetPointer(function, i);
+			const Held& h = p.held[max(pointer, 0)];
+			bool same = pointer >= 0 && h.known && h.segment == function[i].segment && h.index == function[i].index;
+			size_t next = Step(function, i, p, labels);
+			if (same) {
+				i = next;
+				continue;
+			}
+			for (; i < next; ++i) res.push_back(move(function[i]));
+		}
+		function = move(res);
+	}
+
+	// if-goto on a constant becomes goto or disappears
+	void FoldConditions() {
+		vector<VMCommand> res;
+		res.reserve(commands.size());
+		for (size_t i = 0; i < commands.size(); ++i) {
+			VMCommand& c = commands[i];
+			if (c.op == VMOp::PUSH && c.segment == Segment::CONST) {
+				int16_t value = c.index;
+				size_t j = i + 1;
+				for (; j < commands.size() && commands[j].op == VMOp::ARITHMETIC; ++j) {
+					if (commands[j].command == Command::NOT) value = ~value;
+					else if (commands[j].command == Command::NEG) value = -value;
+					else break;
+				}
+				if (j < commands.size() && commands[j].op == VMOp::IF) {
+					if (value) res.push_back({ VMOp::GOTO, Segment::CONST, Command::ADD, commands[j].name, 0 });
+					i = j;
+					continue;
+				}
+			}
+			res.push_back(c);
+		}
+		commands = res;
+	}
+
+	// drops commands no path from the function entry reaches, then labels nothing jumps to
+	static bool RemoveUnreachable(vector<VMCommand>& function) {
+		map<string_view, size_t> labels;
+		for (size_t i = 0; i < function.size(); ++i)
+			if (function[i].op == VMOp::LABEL) labels[function[i].name] = i;
+
+		vector<bool> reached(function.size());
+		vector<size_t> stack = { 0 };
+		while (!stack.empty()) {
+			size_t i = stack.back();
+			stack.pop_back();
+			if (i >= function.size() || reached[i]) continue;
+			reached[i] = true;
+			VMCommand& c = function[i];
+			if ((c.op == VMOp::GOTO || c.op == VMOp::IF) && labels.count(c.name))
+				stack.push_back(labels[c.name]);
+			if (c.op != VMOp::GOTO && c.op != VMOp::RETURN && c.op != VMOp::RETURN_VOID) stack.push_back(i + 1);
+		}
+
+		set<string_view> targets;
+		for (size_t i = 0; i < function.size(); ++i) {
+			VMCommand& c = function[i];
+			if (!reached[i] || (c.op != VMOp::GOTO && c.op != VMOp::IF)) continue;
+			// a goto to the very next command does nothing
+			if (c.op == VMOp::GOTO && i + 1 < function.size() &&
+				function[i + 1].op == VMOp::LABEL && function[i + 1].name == c.name) {
+				reached[i] = false;
+				continue;
+			}
+			targets.insert(c.name);
+		}
+
+		vector<VMCommand> res;
+		res.reserve(function.size());
+		for (size_t i = 0; i < function.size(); ++i) {
+			if (!reached[i] || (function[i].op == VMOp::LABEL && !targets.count(function[i].name))) continue;
+			res.push_back(move(function[i]));
+		}
+		bool changed = res.size() != function.size();
+		function = move(res);
+		return changed;
+	}
+
+	// runs a pass on each function by itself
+	template <class Pass>
+	void ForEachFunction(Pass pass) {
+		vector<VMCommand> res;
+		res.reserve(commands.size());
+		for (size_t begin = 0; begin < commands.size(); ) {
+			size_t end = begin + 1;
+			while (end < commands.size() && commands[end].op != VMOp::FUNCTION) ++end;
+			vector<VMCommand> function(commands.begin() + begin, commands.begin() + end);
+			pass(function);
+			res.insert(res.end(), function.begin(), function.end());
+			begin = end;
+		}
+		commands = move(res);
+	}
+
+	void RemoveDeadCode() {
+		ForEachFunction([](vector<VMCommand>& function) { while (RemoveUnreachable(function)); });
+	}
+
+	static void Write(ostream& os, const VMCommand& c) {
+		switch (c.op) {
+		case VMOp::PUSH: os << "push " << Segtostr(c.segment) << " " << c.index << endl; break;
+		case VMOp::POP: os << "pop " << Segtostr(c.segment) << " " << c.index << endl; break;
+		case VMOp::ARITHMETIC: os << Comtostr(c.command) << endl; break;
+		case VMOp::LABEL: os << "label " << c.name << endl; break;
+		case VMOp::GOTO: os << "goto " << c.name << endl; break;
+		case VMOp::IF: os << "if-goto " << c.name << endl; break;
+		case VMOp::CALL: os << "call " << c.name << " " << c.index << endl; break;
+		case VMOp::FUNCTION: os << "function " << c.name << " " << c.index << endl; break;
+		case VMOp::RETURN: os << "return" << endl; break;
+		case VMOp::RETURN_VOID: os << "return-void" << endl; break;
+		}
+	}
 public:
 	VMWriter() {}
-	VMWriter(string filename) {
-		ofs.open(filename);
-	}
+	// with an empty filename the commands are only kept in memory
+	VMWriter(string filename) : filename(filename) {}
 
 	void WritePush(Segment segment, int index) {
-		ofs << "push " << Segtostr(segment) << " " << index << endl;
+		commands.push_back({ VMOp::PUSH, segment, Command::ADD, "", index });
 	}
 
 	void WritePop(Segment segment, int index) {
-		ofs << "pop " << Segtostr(segment) << " " << index << endl;
+		commands.push_back({ VMOp::POP, segment, Command::ADD, "", index });
 	}
 
 	void WriteArithmetic(Command command) {
-		string com = [&]() {
-			if (command == Command::ADD) return "add";
-			if (command == Command::SUB) return "sub";
-			if (command == Command::NEG) return "neg";
-			if (command == Command::EQ) return "eq";
-			if (command == Command::GT) return "gt";
-			if (command == Command::LT) return "lt";
-			if (command == Command::AND) return "and";
-			if (command == Command::OR) return "or";
-			return "not";
-		}();
-		ofs << com << endl;
+		commands.push_back({ VMOp::ARITHMETIC, Segment::CONST, command, "", 0 });
 	}
 
-	void WriteLabel(string label) {
-		ofs << "label " << label << endl;
+	void WriteLabel(string_view label) {
+		commands.push_back({ VMOp::LABEL, Segment::CONST, Command::ADD, label, 0 });
 	}
 
-	void WriteGoto(string label) {
-		ofs << "goto " << label << endl;
+	void WriteGoto(string_view label) {
+		commands.push_back({ VMOp::GOTO, Segment::CONST, Command::ADD, label, 0 });
 	}
 
-	void WriteIf(string label) {
-		ofs << "if-goto " << label << endl;
+	void WriteIf(string_view label) {
+		commands.push_back({ VMOp::IF, Segment::CONST, Command::ADD, label, 0 });
 	}
 
-	void WriteCall(string name, int nargs) {
-		ofs << "call " << name << " " << nargs << endl;
+	void WriteCall(string_view name, int nargs) {
+		commands.push_back({ VMOp::CALL, Segment::CONST, Command::ADD, name, nargs });
 	}
 
-	void WriteFunction(string name, int nlocals) {
-		ofs << "function " << name << " " << nlocals << endl;
+	void WriteFunction(string_view name, int nlocals) {
+		commands.push_back({ VMOp::FUNCTION, Segment::CONST, Command::ADD, name, nlocals });
 	}
 
 	void WriteReturn() {
-		ofs << "return" << endl;
+		commands.push_back({ VMOp::RETURN, Segment::CONST, Command::ADD, "", 0 });
+	}
+
+	// leaves SP at the caller's ARG, only for callers that know it pushes nothing
+	void WriteReturnVoid() {
+		commands.push_back({ VMOp::RETURN_VOID, Segment::CONST, Command::ADD, "", 0 });
+	}
+
+	// the commands written since a mark can be inspected, taken out and put back
+	size_t Mark() { return commands.size(); }
+
+	vector<VMCommand> Cut(size_t mark) {
+		vector<VMCommand> res(commands.begin() + mark, commands.end());
+		commands.resize(mark);
+		return res;
+	}
+
+	void Append(const vector<VMCommand>& cs) {
+		commands.insert(commands.end(), cs.begin(), cs.end());
+	}
+
+	bool IsConstant(size_t mark, int& value) {
+		if (commands.size() != mark + 1) return false;
+		if (commands[mark].op != VMOp::PUSH || commands[mark].segment != Segment::CONST) return false;
+		value = commands[mark].index;
+		return true;
+	}
+
+	bool HasCall(size_t mark) {
+		return any_of(commands.begin() + mark, commands.end(),
+			[](const VMCommand& c) { return c.op == VMOp::CALL; });
+	}
+
+	void Optimize() {
+		unoptimized = commands.size();
+		FoldConditions();
+		RemoveDeadCode();
+		ForEachFunction(ReusePointers);
+	}
+
+	void Close(bool report = true) {
+		if (filename.empty()) return;
+		if (report) cout << filename << ": " << unoptimized << " -> " << commands.size() << " commands" << endl;
+
+		ofstream ofs(filename);
+		for (auto& c : commands) Write(ofs, c);
 	}
 
-	void Close() { ofs.close(); }
+	// what Close writes
+	string Text() {
+		ostringstream os;
+		for (auto& c : commands) Write(os, c);
+		return os.str();
+	}
+
+	const vector<VMCommand>& Commands() { return commands; }
+
+	size_t Unoptimized() { return unoptimized; }
 };
 
 class CompilationEngine {
 private:
 	ofstream ofs;
+	ostringstream xml; // instead of ofs with Options::intext
+	ostream* out = nullptr;
 	SymbolTable st;
 	VMWriter vmw;
 	JackTokenizer jt;
+	Options options;
+	Program program;
+	shared_ptr<StringPool> pool = make_shared<StringPool>();
+	vector<string> strings;
+	map<string, int> stringindex;
 	int labelnum = 0;
 	string indent;
-	string nowclassname;
+	string_view nowclassname;
+	bool nowvoid = false;
 
 	void AddIndent() { indent += "  "; }
 
@@ -307,7 +791,7 @@ private:
 		indent.pop_back();
 	}
 
-	string Keytostr(Keyword keyword) {
+	string_view Keytostr(Keyword keyword) {
 		if (keyword == Keyword::CLASS) return "class";
 		if (keyword == Keyword::CONSTRUCTOR) return "constructor";
 		if (keyword == Keyword::FUNCTION) return "function";
@@ -331,102 +815,189 @@ private:
 		if (keyword == Keyword::RETURN) return "return";
 	}
 
-	void Write(string word) { ofs << indent << word << endl; }
+	void Write(string_view word) {
+		if (out) *out << indent << word << endl;
+	}
+
+	// "<tag> text </tag>", streamed without building the line
+	void WriteTerminal(string_view tag, string_view text) {
+		if (out) *out << indent << '<' << tag << "> " << text << " </" << tag << '>' << endl;
+	}
 
 	Keyword WriteKeyword() {
 		Keyword keyword = jt.KeyWord();
-		Write("<keyword> " + Keytostr(keyword) + " </keyword>");
+		WriteTerminal("keyword", Keytostr(keyword));
 		jt.Advance();
 		return keyword;
 	}
 
 	void WriteSymbol() {
-		Write("<symbol> " + jt.Symbol() +" </symbol>");
+		WriteTerminal("symbol", jt.Symbol());
 		jt.Advance();
 	}
 
 	void WriteIntegerConstant() {
-		Write("<integerConstant> " + to_string(jt.IntVal()) + " </integerConstant>");
+		if (out) *out << indent << "<integerConstant> " << jt.IntVal() << " </integerConstant>" << endl;
 		jt.Advance();
 	}
 
 	void WriteStringConstant() {
-		Write("<stringConstant> " + jt.StringVal() + " </stringConstant>");
+		WriteTerminal("stringConstant", jt.StringVal());
 		jt.Advance();
 	}
 
-	string WriteIdentifier() {
-		string identifier = jt.Identifier();
-		Write("<identifier> " + identifier + " </identifier>");
+	string_view WriteIdentifier() {
+		string_view identifier = pool->Intern(jt.Identifier());
+		WriteTerminal("identifier", identifier);
 		jt.Advance();
 		return identifier;
 	}
 
-	string WriteType() {
+	string_view WriteType() {
 		if (jt.TokenType() == Token::KEYWORD) return Keytostr(WriteKeyword());
 		else return WriteIdentifier();
 	}
 
-	void CallSubroutine(string identifier = "") {
-		string tmp = (identifier.empty() ? WriteIdentifier() : identifier);
+	// returns the name of the subroutine called
+	string_view CallSubroutine(string_view identifier = {}) {
+		string_view tmp = (identifier.empty() ? WriteIdentifier() : identifier);
 		if (jt.Symbol() == ".") {
 			WriteSymbol();
-			string funcname = WriteIdentifier();
+			string_view funcname = WriteIdentifier();
 
-			if (st.KindOf(tmp) == Kind::NONE) {
-				string classname = tmp;
+			const Symbol* var = st.Find(tmp);
+			if (!var) {
+				string_view name = pool->Join(tmp, funcname);
 
 				WriteSymbol();
 				int nargs = CompileExpressionList();
 				WriteSymbol();
 
-				vmw.WriteCall(classname + "." + funcname, nargs);
+				vmw.WriteCall(name, nargs);
+				return name;
 			} else {
-				string varname = tmp;
-				Segment segment = [](Kind ki) {
-					if (ki == Kind::STATIC) return Segment::STATIC;
-					if (ki == Kind::FIELD) return Segment::THIS;
-					if (ki == Kind::ARG) return Segment::ARG;
-					return Segment::LOCAL;
-				}(st.KindOf(varname));
-
-				vmw.WritePush(segment, st.IndexOf(varname));
+				Symbol symbol = *var;
+				string_view name = pool->Join(st.TypeName(symbol.type), funcname);
+				vmw.WritePush(Kindtoseg(symbol.kind), symbol.index);
 
 				WriteSymbol();
 				int nargs = CompileExpressionList();
 				WriteSymbol();
 
-				vmw.WriteCall(st.TypeOf(varname) + "." + funcname, nargs + 1);
+				vmw.WriteCall(name, nargs + 1);
+				return name;
 			}
 		} else {
-			string funcname = tmp;
+			string_view name = pool->Join(nowclassname, tmp);
 
 			vmw.WritePush(Segment::POINTER, 0);
 			WriteSymbol();
 			int nargs = CompileExpressionList();
 			WriteSymbol();
 
-			vmw.WriteCall(nowclassname + "." + funcname, nargs + 1);
+			vmw.WriteCall(name, nargs + 1);
+			return name;
 		}
 	}
 
-	string GetLabel() {
-		++labelnum;
-		return "LABEL_" + to_string(labelnum);
+	bool IsVoid(string_view subroutine) { return program.voids.count(subroutine); }
+
+	// a name used as a variable; before a '.' it may also be a class, see CallSubroutine
+	const Symbol& Variable(string_view name) {
+		const Symbol* symbol = st.Find(name);
+		if (!symbol) throw runtime_error(string(nowclassname) + ": " + string(name) + " is not defined");
+		return *symbol;
+	}
+
+	static Segment Kindtoseg(Kind kind) {
+		if (kind == Kind::STATIC) return Segment::STATIC;
+		if (kind == Kind::FIELD) return Segment::THIS;
+		if (kind == Kind::ARG) return Segment::ARG;
+		return Segment::LOCAL;
+	}
+
+	string_view GetLabel() { return pool->Label(++labelnum); }
+
+	void WriteNewString(string_view cs) {
+		vmw.WritePush(Segment::CONST, cs.size());
+		vmw.WriteCall("String.new", 1);
+		for (char c : cs) {
+			vmw.WritePush(Segment::CONST, c);
+			vmw.WriteCall("String.appendChar", 2);
+		}
+	}
+
+	// pooled literals live in the statics following the declared ones
+	int PooledString(string cs) {
+		if (!stringindex.count(cs)) {
+			stringindex[cs] = strings.size();
+			strings.push_back(cs);
+		}
+		return st.VarCount(Kind::STATIC) + stringindex[cs];
+	}
+
+	void WriteStringPool() {
+		vmw.WriteFunction(pool->Join(nowclassname, "$strings"), 0);
+		for (int i = 0; i < (int)strings.size(); ++i) {
+			WriteNewString(strings[i]);
+			vmw.WritePop(Segment::STATIC, st.VarCount(Kind::STATIC) + i);
+		}
+		vmw.WritePush(Segment::CONST, 0);
+		vmw.WriteReturn();
 	}
 
 public:
-	CompilationEngine(string ifilename, string ofilename) {
-		jt = JackTokenizer(ifilename);
-		ofs.open(ofilename + ".xml");
-		vmw = VMWriter(ofilename + ".vm");
+	CompilationEngine(string ifilename, string ofilename,
+		Options options = Options(), Program program = Program()) {
+		this->options = options;
+		this->program = program;
+		jt = JackTokenizer(ifilename, options.pipeline);
+		// no output files when ofilename is empty, see Commands(), and with intext only XmlText()
+		// and VmText()
+		if (options.intext) out = &xml;
+		else if (!ofilename.empty()) {
+			ofs.open(ofilename + ".xml");
+			out = &ofs;
+		}
+		vmw = VMWriter(ofilename.empty() || options.intext ? "" : ofilename + ".vm");
 
 		CompileClass();
+		if (options.stats) options.stats->Lap("compile");
+
+		vmw.Optimize();
+		if (options.stats) {
+			options.stats->Lap("optimize");
+			CountStats(*options.stats);
+		}
 
-		vmw.Close();
+		vmw.Close(!options.quiet);
 		ofs.close();
+		if (options.stats) options.stats->Lap("write");
+	}
+
+	void CountStats(Stats& stats) {
+		stats.Count("classes");
+		stats.Count("tokens", jt.Tokens());
+		stats.Count("vm_commands", vmw.Unoptimized());
+		stats.Count("vm_commands_optimized", vmw.Commands().size());
+		auto& commands = vmw.Commands();
+		for (size_t begin = 0; begin < commands.size(); ) {
+			size_t end = begin + 1;
+			while (end < commands.size() && commands[end].op != VMOp::FUNCTION) ++end;
+			stats.Function(string(commands[begin].name), end - begin - 1);
+			begin = end;
+		}
 	}
 
+	const vector<VMCommand>& Commands() { return vmw.Commands(); }
+
+	string VmText() { return vmw.Text(); }
+
+	string XmlText() { return xml.str(); }
+
+	// the names in Commands() point into it, keep it to use them after the engine is gone
+	shared_ptr<StringPool> Names() { return pool; }
+
 	void CompileClass() {
 		Write("<class>");
 		AddIndent();
@@ -445,6 +1016,8 @@ public:
 		}
 		WriteSymbol();
 
+		if (options.poolstrings) WriteStringPool();
+
 		DeleteIndent();
 		Write("</class>");
 	}
@@ -455,8 +1028,8 @@ public:
 
 		Keyword keyword = WriteKeyword();
 		Kind kind = (keyword == Keyword::STATIC ? Kind::STATIC : Kind::FIELD);
-		string type = WriteType();
-		string name = WriteIdentifier();
+		string_view type = WriteType();
+		string_view name = WriteIdentifier();
 		st.Define(name, type, kind);
 		
 		while (jt.Symbol() != ";") {
@@ -481,7 +1054,9 @@ public:
 			WriteKeyword();
 		else
 			WriteType();
-		string subroutinename = WriteIdentifier();
+		string_view subroutinename = WriteIdentifier();
+		string_view functionname = pool->Join(nowclassname, subroutinename);
+		nowvoid = IsVoid(functionname);
 		
 		if (keyword == Keyword::METHOD)
 			st.Define("this", nowclassname, Kind::ARG);
@@ -498,7 +1073,7 @@ public:
 		int localcnt = 0;
 		while (jt.KeyWord() == Keyword::VAR)
 			localcnt += CompileVarDec();
-		vmw.WriteFunction(nowclassname + "." + subroutinename, localcnt);
+		vmw.WriteFunction(functionname, localcnt);
 
 		switch (keyword) 	{
 		case Keyword::METHOD:
@@ -512,6 +1087,14 @@ public:
 			break;
 		}
 
+		// the pools are built before anything else runs
+		if (options.poolstrings && nowclassname == "Main" && subroutinename == "main") {
+			for (auto& classname : program.classnames) {
+				vmw.WriteCall(pool->Join(classname, "$strings"), 0);
+				vmw.WritePop(Segment::TEMP, 0);
+			}
+		}
+
 		CompileStatements();
 		WriteSymbol();
 
@@ -527,8 +1110,8 @@ public:
 		AddIndent();
 
 		if (jt.TokenType() != Token::SYMBOL) {
-			string type = WriteType();
-			string name = WriteIdentifier();
+			string_view type = WriteType();
+			string_view name = WriteIdentifier();
 			st.Define(name, type, Kind::ARG);
 			while (jt.Symbol() == ",") {
 				WriteSymbol();
@@ -548,8 +1131,8 @@ public:
 
 		int cnt = 1;
 		WriteKeyword();
-		string type = WriteType();
-		string name = WriteIdentifier();
+		string_view type = WriteType();
+		string_view name = WriteIdentifier();
 		st.Define(name, type, Kind::VAR);
 		while (jt.Symbol() == ",") {
 			++cnt;
@@ -588,10 +1171,11 @@ public:
 		AddIndent();
 
 		WriteKeyword();
-		CallSubroutine();
+		string_view subroutine = CallSubroutine();
 		WriteSymbol();
 
-		vmw.WritePop(Segment::TEMP, 0); // return value isn't used
+		if (!IsVoid(subroutine))
+			vmw.WritePop(Segment::TEMP, 0); // return value isn't used
 
 		DeleteIndent();
 		Write("</doStatement>");
@@ -602,36 +1186,49 @@ public:
 		AddIndent();
 
 		WriteKeyword();
-		string name = WriteIdentifier();
-		Segment segment = [](Kind ki) {
-			if (ki == Kind::STATIC) return Segment::STATIC;
-			if (ki == Kind::FIELD) return Segment::THIS;
-			if (ki == Kind::ARG) return Segment::ARG;
-			return Segment::LOCAL;
-		}(st.KindOf(name));
+		string_view name = WriteIdentifier();
+		Symbol symbol = Variable(name);
+		Segment segment = Kindtoseg(symbol.kind);
 
 		if (jt.Symbol() == "[") {
+			size_t mark = vmw.Mark();
+			int index = 0;
 			WriteSymbol();
 			CompileExpression();
 			WriteSymbol();
-		
-			vmw.WritePush(segment, st.IndexOf(name));
-			vmw.WriteArithmetic(Command::ADD);
+			bool constant = vmw.IsConstant(mark, index);
+			bool calls = vmw.HasCall(mark);
+			vector<VMCommand> subscript = vmw.Cut(mark);
+			if (constant) subscript.clear();
 
 			WriteSymbol();
 			CompileExpression();
 			WriteSymbol();
 
-			vmw.WritePop(Segment::TEMP, 0);
-			vmw.WritePop(Segment::POINTER, 1);
-			vmw.WritePush(Segment::TEMP, 0);
-			vmw.WritePop(Segment::THAT, 0);
+			if (!calls && !vmw.HasCall(mark)) {
+				// without a call on either side nothing the value reads can change, so it can go first
+				vmw.Append(subscript);
+				vmw.WritePush(segment, symbol.index);
+				if (!constant) vmw.WriteArithmetic(Command::ADD);
+				vmw.WritePop(Segment::POINTER, 1);
+				vmw.WritePop(Segment::THAT, index);
+			} else {
+				vector<VMCommand> value = vmw.Cut(mark);
+				vmw.Append(subscript);
+				vmw.WritePush(segment, symbol.index);
+				if (!constant) vmw.WriteArithmetic(Command::ADD);
+				vmw.Append(value);
+				vmw.WritePop(Segment::TEMP, 0);
+				vmw.WritePop(Segment::POINTER, 1);
+				vmw.WritePush(Segment::TEMP, 0);
+				vmw.WritePop(Segment::THAT, index);
+			}
 		} else {
 			WriteSymbol();
 			CompileExpression();
 			WriteSymbol();
 
-			vmw.WritePop(segment, st.IndexOf(name));
+			vmw.WritePop(segment, symbol.index);
 		}
 
 
@@ -643,23 +1240,28 @@ public:
 		Write("<whileStatement>");
 		AddIndent();
 
-		string whilelabel = GetLabel();
-		string falselabel = GetLabel();
+		string_view whilelabel = GetLabel();
+		string_view falselabel = GetLabel();
 
 		WriteKeyword();
 		WriteSymbol();
 
-		vmw.WriteLabel(whilelabel);
+		// rotated: the condition is tested once on entry and again at the bottom
+		size_t mark = vmw.Mark();
 		CompileExpression();
+		vector<VMCommand> condition = vmw.Cut(mark);
+		vmw.Append(condition);
 		vmw.WriteArithmetic(Command::NOT);
 		WriteSymbol();
 		WriteSymbol();
 
 		vmw.WriteIf(falselabel);
+		vmw.WriteLabel(whilelabel);
 		CompileStatements();
 		WriteSymbol();
 
-		vmw.WriteGoto(whilelabel);
+		vmw.Append(condition);
+		vmw.WriteIf(whilelabel);
 		vmw.WriteLabel(falselabel);
 
 		DeleteIndent();
@@ -673,11 +1275,12 @@ public:
 		WriteKeyword();
 		if (jt.TokenType() != Token::SYMBOL || jt.Symbol() != ";")
 			CompileExpression();
-		else
+		else if (!nowvoid)
 			vmw.WritePush(Segment::CONST, 0);
 		WriteSymbol();
 
-		vmw.WriteReturn();
+		if (nowvoid) vmw.WriteReturnVoid();
+		else vmw.WriteReturn();
 
 		DeleteIndent();
 		Write("</returnStatement>");
@@ -687,8 +1290,8 @@ public:
 		Write("<ifStatement>");
 		AddIndent();
 
-		string elselabel = GetLabel();
-		string endlabel = GetLabel();
+		string_view elselabel = GetLabel();
+		string_view endlabel = GetLabel();
 
 		WriteKeyword();
 		WriteSymbol();
@@ -719,7 +1322,7 @@ public:
 	}
 
 	void CompileExpression() {
-		auto isOp = [](string x) {
+		auto isOp = [](string_view x) {
 			for (auto& s : { "+","-","*","/","&amp;","|","&lt;","&gt;","=" })
 				if (x == s) return true;
 			return false;
@@ -730,7 +1333,7 @@ public:
 
 		CompileTerm();
 		while (jt.TokenType() == Token::SYMBOL && isOp(jt.Symbol())) {
-			string op = jt.Symbol();
+			string op(jt.Symbol());
 
 			WriteSymbol();
 			CompileTerm();
@@ -758,13 +1361,9 @@ public:
 			vmw.WritePush(Segment::CONST, jt.IntVal());
 			WriteIntegerConstant();
 		} else if (jt.TokenType() == Token::STRING_CONST) {
-			string cs = jt.StringVal();
-			vmw.WritePush(Segment::CONST, cs.size());
-			vmw.WriteCall("String.new", 1);
-			for (char& c : cs) {
-				vmw.WritePush(Segment::CONST, c);
-				vmw.WriteCall("String.appendChar", 2);
-			}
+			string cs(jt.StringVal());
+			if (options.poolstrings) vmw.WritePush(Segment::STATIC, PooledString(cs));
+			else WriteNewString(cs);
 			WriteStringConstant();
 		} else if (jt.TokenType() == Token::KEYWORD) {
 			switch (jt.KeyWord()) {
@@ -783,28 +1382,32 @@ public:
 
 			WriteKeyword();
 		} else if (jt.TokenType() == Token::IDENTIFIER) {
-			string name = WriteIdentifier();
-			Segment segment = [](Kind ki) {
-				if (ki == Kind::STATIC) return Segment::STATIC;
-				if (ki == Kind::FIELD) return Segment::THIS;
-				if (ki == Kind::ARG) return Segment::ARG;
-				return Segment::LOCAL;
-			}(st.KindOf(name));
+			string_view name = WriteIdentifier();
 
 			if (jt.TokenType() == Token::SYMBOL) {
 				if (jt.Symbol() == "[") {
+					size_t mark = vmw.Mark();
+					int index = 0;
 					WriteSymbol();
 					CompileExpression();
 					WriteSymbol();
 
-					vmw.WritePush(segment, st.IndexOf(name));
-					vmw.WriteArithmetic(Command::ADD);
+					const Symbol& var = Variable(name);
+					if (vmw.IsConstant(mark, index)) {
+						vmw.Cut(mark);
+						vmw.WritePush(Kindtoseg(var.kind), var.index);
+					} else {
+						vmw.WritePush(Kindtoseg(var.kind), var.index);
+						vmw.WriteArithmetic(Command::ADD);
+					}
 					vmw.WritePop(Segment::POINTER, 1);
-					vmw.WritePush(Segment::THAT, 0);
+					vmw.WritePush(Segment::THAT, index);
 				} else if (jt.Symbol() == "(" || jt.Symbol() == ".") {
-					CallSubroutine(name);
+					// a void call used as a value still has to leave one
+					if (IsVoid(CallSubroutine(name))) vmw.WritePush(Segment::CONST, 0);
 				} else {
-					vmw.WritePush(segment, st.IndexOf(name));
+					const Symbol& var = Variable(name);
+					vmw.WritePush(Kindtoseg(var.kind), var.index);
 				}
 			}
 		} else {
@@ -813,7 +1416,7 @@ public:
 				CompileExpression();
 				WriteSymbol();
 			} else {
-				string symbol = jt.Symbol();
+				string symbol(jt.Symbol());
 				WriteSymbol();
 				CompileTerm();
 				if (symbol == "~") vmw.WriteArithmetic(Command::NOT);
@@ -847,11 +1450,86 @@ public:
 	}
 };
 
+class CompileCache {
+private:
+	filesystem::path dir;
+	int hits = 0, misses = 0;
+
+	static string Hash(string data) {
+		uint64_t hash = 14695981039346656037ull;
+		for (unsigned char c : data) {
+			hash ^= c;
+			hash *= 1099511628211ull;
+		}
+		stringstream ss;
+		ss << hex << setw(16) << setfill('0') << hash;
+		return ss.str();
+	}
+public:
+	CompileCache(string dir) : dir(dir) {
+		filesystem::create_directories(dir);
+	}
+
+	// the salt holds everything besides the source that changes the output
+	static string Key(string file, string salt) {
+		ifstream ifs(file, ios::binary);
+		stringstream ss;
+		ss << COMPILER_VERSION << '\0' << salt << '\0' << ifs.rdbuf();
+		return Hash(ss.str());
+	}
+
+	bool Restore(string key, string ofilename) {
+		namespace fs = filesystem;
+		auto vm = dir / (key + ".vm"), xml = dir / (key + ".xml");
+		if (!fs::exists(vm) || !fs::exists(xml)) {
+			++misses;
+			return false;
+		}
+		fs::copy_file(vm, ofilename + ".vm", fs::copy_options::overwrite_existing);
+		fs::copy_file(xml, ofilename + ".xml", fs::copy_options::overwrite_existing);
+		++hits;
+		return true;
+	}
+
+	void Store(string key, string ofilename) {
+		namespace fs = filesystem;
+		fs::copy_file(ofilename + ".vm", dir / (key + ".vm"), fs::copy_options::overwrite_existing);
+		fs::copy_file(ofilename + ".xml", dir / (key + ".xml"), fs::copy_options::overwrite_existing);
+	}
+
+	void Report() {
+		cout << "cache: " << hits << " hits, " << misses << " misses" << endl;
+	}
+};
+
 class JackAnalyzer {
 public:
-	JackAnalyzer(string source) {
-		vector<string> files;
+	static set<string, less<> > VoidSubroutines(vector<string> files) {
+		set<string, less<> > voids;
+		for (auto& file : files) {
+			JackTokenizer jt(file);
+			string classname;
+			while (jt.HasMoreTokens()) {
+				if (jt.TokenType() == Token::KEYWORD && jt.KeyWord() == Keyword::CLASS) {
+					jt.Advance();
+					classname = jt.Identifier();
+				} else if (jt.TokenType() == Token::KEYWORD && (jt.KeyWord() == Keyword::FUNCTION ||
+					jt.KeyWord() == Keyword::METHOD || jt.KeyWord() == Keyword::CONSTRUCTOR)) {
+					jt.Advance();
+					bool isvoid = jt.TokenType() == Token::KEYWORD && jt.KeyWord() == Keyword::VOID;
+					jt.Advance();
+					// Sys.init calls Main.main with the usual convention
+					if (isvoid && !(classname == "Main" && jt.Identifier() == "main"))
+						voids.insert(classname + "." + string(jt.Identifier()));
+				}
+				jt.Advance();
+			}
+		}
+		return voids;
+	}
 
+	static vector<string> SourceFiles(string source) {
+		vector<string> files;
 		namespace fs = filesystem;
 		if (fs::is_directory(source)) {
 			for (auto& p : fs::directory_iterator(source))
@@ -860,25 +1538,307 @@ public:
 		} else {
 			files.push_back(source);
 		}
+		return files;
+	}
 
+	static Program ScanProgram(const vector<string>& files, Options options) {
+		Program program;
+		for (auto& file : files)
+			program.classnames.push_back(filesystem::path(file).stem().string());
+		if (options.stats) options.stats->Lap("setup");
+		if (options.wholeprogram) {
+			program.voids = VoidSubroutines(files);
+			if (options.stats) options.stats->Lap("scan");
+		}
+		return program;
+	}
+
+	// everything besides its own source that changes what a class compiles to
+	static string Salt(Options options, const Program& program) {
+		string salt = options.poolstrings ? "pool-strings" : "";
+		if (options.poolstrings)
+			for (auto& classname : program.classnames) salt += " " + classname;
+		salt += options.wholeprogram ? " whole-program" : "";
+		for (auto& subroutine : program.voids) salt += " " + subroutine;
+		return salt;
+	}
+
+	JackAnalyzer(string source, Options options = Options()) {
+		vector<string> files = SourceFiles(source);
+		Program program = ScanProgram(files, options);
+
+		if (options.cachedir.empty()) {
+			for (auto& file : files) {
+				CompilationEngine(file, file.substr(0, file.size() - 5), options, program);
+			}
+			return;
+		}
+
+		string salt = Salt(options, program);
+		CompileCache cache(options.cachedir);
 		for (auto& file : files) {
-			CompilationEngine(file, file.substr(0, file.size() - 5));
+			string ofilename = file.substr(0, file.size() - 5);
+			string key = cache.Key(file, salt);
+			bool hit = cache.Restore(key, ofilename);
+			if (options.stats) {
+				options.stats->Lap("cache");
+				options.stats->Count(hit ? "cache_hits" : "cache_misses");
+			}
+			if (hit) continue;
+			CompilationEngine(file, ofilename, options, program);
+			cache.Store(key, ofilename);
+			if (options.stats) options.stats->Lap("cache");
+		}
+		cache.Report();
+	}
+};
+
+// outputs of the classes earlier requests compiled, shared by the --serve workers
+class MemoryCache {
+public:
+	typedef pair<string, string> Output; // .vm, .xml
+private:
+	mutex m;
+	unordered_map<string, Output> outputs;
+	queue<string> order; // oldest first, for eviction
+	size_t bytes = 0, limit;
+public:
+	explicit MemoryCache(size_t limit = 256 << 20) : limit(limit) {}
+
+	bool Restore(string key, Output& output) {
+		lock_guard<mutex> lock(m);
+		auto it = outputs.find(key);
+		if (it == outputs.end()) return false;
+		output = it->second;
+		return true;
+	}
+
+	// the oldest entries go once the texts take more than limit bytes
+	void Store(string key, const Output& output) {
+		lock_guard<mutex> lock(m);
+		auto [it, inserted] = outputs.emplace(key, output);
+		if (inserted) order.push(key);
+		else {
+			bytes -= it->second.first.size() + it->second.second.size();
+			it->second = output;
+		}
+		bytes += output.first.size() + output.second.size();
+		while (bytes > limit && order.size() > 1) {
+			auto old = outputs.find(order.front());
+			bytes -= old->second.first.size() + old->second.second.size();
+			outputs.erase(old);
+			order.pop();
+		}
+	}
+};
+
+// --serve: one request per line on stdin, one response per line on stdout, in the order
+// they finish; requests run concurrently on a fixed set of workers
+//   {"id": 1, "source": "Pong/", "pool_strings": true, "whole_program": false, "pipeline": false}
+//   {"id": 1, "ok": true, "classes": 4, "compiled": 1, "cached": 3, "ms": 2.41}
+class CompileServer {
+private:
+	MemoryCache cache;
+	ostream& os;
+	mutex outm, queuem;
+	array<mutex, 64> filelocks; // by output path, so requests for one directory write in turn
+	condition_variable ready;
+	queue<string> requests;
+	bool closed = false;
+	vector<thread> workers;
+
+	// a flat object: the raw JSON text of each value, strings still quoted
+	static map<string, string> ParseObject(const string& line) {
+		map<string, string> values;
+		size_t i = line.find('{');
+		if (i == string::npos) throw runtime_error("request is not a JSON object");
+		auto skip = [&]() { while (i < line.size() && isspace((unsigned char)line[i])) ++i; };
+		auto token = [&]() {
+			skip();
+			size_t begin = i;
+			if (i < line.size() && line[i] == '"') {
+				for (++i; i < line.size() && line[i] != '"'; ++i)
+					if (line[i] == '\\') ++i;
+				++i;
+			} else {
+				while (i < line.size() && line[i] != ',' && line[i] != '}' && !isspace((unsigned char)line[i])) ++i;
+			}
+			if (i > line.size()) throw runtime_error("unterminated string");
+			return line.substr(begin, i - begin);
+		};
+		++i;
+		skip();
+		while (i < line.size() && line[i] != '}') {
+			string key = Unquote(token());
+			skip();
+			if (i >= line.size() || line[i] != ':') throw runtime_error("expected ':' after \"" + key + "\"");
+			++i;
+			values[key] = token();
+			skip();
+			if (i < line.size() && line[i] == ',') ++i;
+			skip();
+		}
+		return values;
+	}
+
+	static string Unquote(string value) {
+		if (value.size() < 2 || value.front() != '"') throw runtime_error("expected a string: " + value);
+		string res;
+		for (size_t i = 1; i + 1 < value.size(); ++i) {
+			char c = value[i];
+			if (c == '\\') {
+				c = value[++i];
+				if (c == 'n') c = '\n';
+				else if (c == 't') c = '\t';
+			}
+			res += c;
 		}
+		return res;
+	}
+
+	static string Quote(string_view str) {
+		string res = "\"";
+		for (char c : str) {
+			if (c == '"' || c == '\\') res += '\\';
+			if (c == '\n') res += "\\n";
+			else res += c;
+		}
+		return res + "\"";
+	}
+
+	void WriteOutput(string ofilename, const MemoryCache::Output& output) {
+		string path = filesystem::absolute(ofilename).lexically_normal().string();
+		lock_guard<mutex> lock(filelocks[hash<string>()(path) % filelocks.size()]);
+		ofstream(ofilename + ".vm", ios::binary) << output.first;
+		ofstream(ofilename + ".xml", ios::binary) << output.second;
+	}
+
+	string Handle(const string& line) {
+		auto start = chrono::steady_clock::now();
+		string id = "null";
+		try {
+			map<string, string> request = ParseObject(line);
+			if (request.count("id")) id = request["id"];
+			if (!request.count("source")) throw runtime_error("no source");
+			Options options;
+			options.quiet = true;
+			options.intext = true;
+			options.poolstrings = request["pool_strings"] == "true";
+			options.wholeprogram = request["whole_program"] == "true";
+			options.pipeline = request["pipeline"] == "true";
+
+			string source = Unquote(request["source"]);
+			if (!filesystem::exists(source)) throw runtime_error(source + " does not exist");
+			vector<string> files = JackAnalyzer::SourceFiles(source);
+			if (files.empty()) throw runtime_error("no .jack files in " + source);
+			Program program = JackAnalyzer::ScanProgram(files, options);
+			string salt = JackAnalyzer::Salt(options, program);
+			int compiled = 0;
+			for (auto& file : files) {
+				string ofilename = file.substr(0, file.size() - 5);
+				string key = CompileCache::Key(file, salt);
+				MemoryCache::Output output;
+				if (!cache.Restore(key, output)) {
+					CompilationEngine ce(file, ofilename, options, program);
+					output = { ce.VmText(), ce.XmlText() };
+					cache.Store(key, output);
+					++compiled;
+				}
+				WriteOutput(ofilename, output);
+			}
+
+			double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+			stringstream ss;
+			ss << "{\"id\": " << id << ", \"ok\": true, \"classes\": " << files.size()
+				<< ", \"compiled\": " << compiled << ", \"cached\": " << files.size() - compiled
+				<< ", \"ms\": " << fixed << setprecision(2) << ms << "}";
+			return ss.str();
+		} catch (exception& e) {
+			return "{\"id\": " + id + ", \"ok\": false, \"error\": " + Quote(e.what()) + "}";
+		}
+	}
+
+	void Work() {
+		while (true) {
+			string line;
+			{
+				unique_lock<mutex> lock(queuem);
+				ready.wait(lock, [&]() { return closed || !requests.empty(); });
+				if (requests.empty()) return;
+				line = move(requests.front());
+				requests.pop();
+			}
+			string response = Handle(line);
+			lock_guard<mutex> lock(outm);
+			os << response << endl;
+		}
+	}
+public:
+	CompileServer(ostream& os, int threads) : os(os) {
+		for (int i = 0; i < max(threads, 1); ++i) workers.emplace_back([this]() { Work(); });
+	}
+
+	// returns at the end of the input, once every request has been answered
+	void Serve(istream& is) {
+		string line;
+		while (getline(is, line)) {
+			if (line.find_first_not_of(" \t\r") == string::npos) continue;
+			lock_guard<mutex> lock(queuem);
+			requests.push(line);
+			ready.notify_one();
+		}
+		{
+			lock_guard<mutex> lock(queuem);
+			closed = true;
+		}
+		ready.notify_all();
+		for (auto& worker : workers) worker.join();
 	}
 };
 
+#ifndef NO_MAIN
 int main(int argc, char** argv) {
+	Options options;
+	Stats stats;
+	string filename, statsfile;
+	bool printstats = false, serve = false;
+	for (int i = 1; i < argc; ++i) {
+		string arg = argv[i];
+		if (arg == "--pool-strings") options.poolstrings = true;
+		else if (arg == "--whole-program") options.wholeprogram = true;
+		else if (arg == "--pipeline") options.pipeline = true;
+		else if (arg == "--cache") options.cachedir = "*";
+		else if (arg.rfind("--cache=", 0) == 0) options.cachedir = arg.substr(8);
+		else if (arg == "--stats") printstats = true;
+		else if (arg.rfind("--stats=", 0) == 0) statsfile = arg.substr(8);
+		else if (arg == "--serve") serve = true;
+		else filename = arg;
+	}
+
+	if (serve) {
+		CompileServer server(cout, thread::hardware_concurrency());
+		server.Serve(cin);
+		return 0;
+	}
+	if (printstats || !statsfile.empty()) options.stats = &stats;
+
 	namespace fs = filesystem;
-	fs::path source = fs::absolute(argv[1]).remove_filename();
-	fs::path exe = fs::absolute(argv[0]).parent_path();
-	fs::path os = exe / "OS";
-	for (auto& p : fs::directory_iterator(os)) {
-		auto to = source / p.path().filename();
-		if (fs::exists(to)) continue;
-		fs::copy(p, to);
+	if (options.cachedir == "*") {
+		fs::path source = fs::absolute(filename);
+		if (!fs::is_directory(source)) source = source.parent_path();
+		options.cachedir = (source / ".jackcache").string();
+	}
+
+	try {
+		JackAnalyzer ja(filename, options);
+	} catch (exception& e) {
+		cerr << "JackAnalyzer: " << e.what() << endl;
+		return 1;
 	}
 
-	JackAnalyzer ja(argv[1]);
+	if (printstats) stats.Print(cout, "vm commands");
+	if (!statsfile.empty()) stats.WriteJson(statsfile, "JackAnalyzer", "vm commands");
 
 	return 0;
-}
\ No newline at end of file
+}
+#endif
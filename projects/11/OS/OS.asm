@@ -0,0 +1,28397 @@
+// library Array Keyboard Math Memory Output Screen String Sys
+//@ Array.vm 1 Array.new
+(Array.new)
+D=0
+//@ Array.vm 2 Array.new
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Array.vm 3 Array.new
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Array.vm 4 Array.new
+@$OS.ARITHMETIC_IF_0$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_0$)
+//@ Array.vm 5 Array.new
+@SP
+D=M-1
+A=D
+M=!M
+//@ Array.vm 6 Array.new
+@SP
+M=M-1
+A=M
+D=M
+@Array.new$IF_TRUE0
+D;JNE
+//@ Array.vm 7 Array.new
+@Array.new$IF_FALSE0
+0;JMP
+//@ Array.vm 8 Array.new
+(Array.new$IF_TRUE0)
+//@ Array.vm 9 Array.new
+@2
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Array.vm 10 Array.new
+@R13
+M=1
+@Sys.error
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_0$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_0$)
+//@ Array.vm 11 Array.new
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Array.vm 12 Array.new
+(Array.new$IF_FALSE0)
+//@ Array.vm 13 Array.new
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Array.vm 14 Array.new
+@R13
+M=1
+@Memory.alloc
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_1$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_1$)
+//@ Array.vm 15 Array.new
+@$OS.RETURN$
+0;JMP
+//@ Array.vm 16 Array.dispose
+(Array.dispose)
+D=0
+//@ Array.vm 17 Array.dispose
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Array.vm 18 Array.dispose
+@SP
+M=M-1
+A=M
+D=M
+@3
+M=D
+//@ Array.vm 19 Array.dispose
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Array.vm 20 Array.dispose
+@R13
+M=1
+@Memory.deAlloc
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_2$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_2$)
+//@ Array.vm 21 Array.dispose
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Array.vm 22 Array.dispose
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Array.vm 23 Array.dispose
+@$OS.RETURN$
+0;JMP
+//@ Keyboard.vm 1 Keyboard.init
+(Keyboard.init)
+D=0
+//@ Keyboard.vm 2 Keyboard.init
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Keyboard.vm 3 Keyboard.init
+@$OS.RETURN$
+0;JMP
+//@ Keyboard.vm 4 Keyboard.keyPressed
+(Keyboard.keyPressed)
+D=0
+//@ Keyboard.vm 5 Keyboard.keyPressed
+@24576
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Keyboard.vm 6 Keyboard.keyPressed
+@R13
+M=1
+@Memory.peek
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_3$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_3$)
+//@ Keyboard.vm 7 Keyboard.keyPressed
+@$OS.RETURN$
+0;JMP
+//@ Keyboard.vm 8 Keyboard.readChar
+(Keyboard.readChar)
+D=0
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Keyboard.vm 9 Keyboard.readChar
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Keyboard.vm 10 Keyboard.readChar
+@R13
+M=1
+@Output.printChar
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_4$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_4$)
+//@ Keyboard.vm 11 Keyboard.readChar
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Keyboard.vm 12 Keyboard.readChar
+(Keyboard.readChar$WHILE_EXP0)
+//@ Keyboard.vm 13 Keyboard.readChar
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Keyboard.vm 14 Keyboard.readChar
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Keyboard.vm 15 Keyboard.readChar
+@$OS.ARITHMETIC_IF_1$
+D=A
+@$OS.EQ$
+0;JMP
+($OS.ARITHMETIC_IF_1$)
+//@ Keyboard.vm 16 Keyboard.readChar
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Keyboard.vm 17 Keyboard.readChar
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Keyboard.vm 18 Keyboard.readChar
+@$OS.ARITHMETIC_IF_2$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_2$)
+//@ Keyboard.vm 19 Keyboard.readChar
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ Keyboard.vm 20 Keyboard.readChar
+@SP
+D=M-1
+A=D
+M=!M
+//@ Keyboard.vm 21 Keyboard.readChar
+@SP
+M=M-1
+A=M
+D=M
+@Keyboard.readChar$WHILE_END0
+D;JNE
+//@ Keyboard.vm 22 Keyboard.readChar
+@R13
+M=0
+@Keyboard.keyPressed
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_5$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_5$)
+//@ Keyboard.vm 23 Keyboard.readChar
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Keyboard.vm 24 Keyboard.readChar
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Keyboard.vm 25 Keyboard.readChar
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Keyboard.vm 26 Keyboard.readChar
+@$OS.ARITHMETIC_IF_3$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_3$)
+//@ Keyboard.vm 27 Keyboard.readChar
+@SP
+M=M-1
+A=M
+D=M
+@Keyboard.readChar$IF_TRUE0
+D;JNE
+//@ Keyboard.vm 28 Keyboard.readChar
+@Keyboard.readChar$IF_FALSE0
+0;JMP
+//@ Keyboard.vm 29 Keyboard.readChar
+(Keyboard.readChar$IF_TRUE0)
+//@ Keyboard.vm 30 Keyboard.readChar
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Keyboard.vm 31 Keyboard.readChar
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+M=D
+//@ Keyboard.vm 32 Keyboard.readChar
+(Keyboard.readChar$IF_FALSE0)
+//@ Keyboard.vm 33 Keyboard.readChar
+@Keyboard.readChar$WHILE_EXP0
+0;JMP
+//@ Keyboard.vm 34 Keyboard.readChar
+(Keyboard.readChar$WHILE_END0)
+//@ Keyboard.vm 35 Keyboard.readChar
+@R13
+M=0
+@String.backSpace
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_6$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_6$)
+//@ Keyboard.vm 36 Keyboard.readChar
+@R13
+M=1
+@Output.printChar
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_7$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_7$)
+//@ Keyboard.vm 37 Keyboard.readChar
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Keyboard.vm 38 Keyboard.readChar
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Keyboard.vm 39 Keyboard.readChar
+@R13
+M=1
+@Output.printChar
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_8$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_8$)
+//@ Keyboard.vm 40 Keyboard.readChar
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Keyboard.vm 41 Keyboard.readChar
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Keyboard.vm 42 Keyboard.readChar
+@$OS.RETURN$
+0;JMP
+//@ Keyboard.vm 43 Keyboard.readLine
+(Keyboard.readLine)
+D=0
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Keyboard.vm 44 Keyboard.readLine
+@80
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Keyboard.vm 45 Keyboard.readLine
+@R13
+M=1
+@String.new
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_9$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_9$)
+//@ Keyboard.vm 46 Keyboard.readLine
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+A=A+1
+M=D
+//@ Keyboard.vm 47 Keyboard.readLine
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Keyboard.vm 48 Keyboard.readLine
+@R13
+M=1
+@Output.printString
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_10$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_10$)
+//@ Keyboard.vm 49 Keyboard.readLine
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Keyboard.vm 50 Keyboard.readLine
+@R13
+M=0
+@String.newLine
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_11$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_11$)
+//@ Keyboard.vm 51 Keyboard.readLine
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+M=D
+//@ Keyboard.vm 52 Keyboard.readLine
+@R13
+M=0
+@String.backSpace
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_12$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_12$)
+//@ Keyboard.vm 53 Keyboard.readLine
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+M=D
+//@ Keyboard.vm 54 Keyboard.readLine
+(Keyboard.readLine$WHILE_EXP0)
+//@ Keyboard.vm 55 Keyboard.readLine
+@4
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Keyboard.vm 56 Keyboard.readLine
+@SP
+D=M-1
+A=D
+M=!M
+//@ Keyboard.vm 57 Keyboard.readLine
+@SP
+D=M-1
+A=D
+M=!M
+//@ Keyboard.vm 58 Keyboard.readLine
+@SP
+M=M-1
+A=M
+D=M
+@Keyboard.readLine$WHILE_END0
+D;JNE
+//@ Keyboard.vm 59 Keyboard.readLine
+@R13
+M=0
+@Keyboard.readChar
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_13$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_13$)
+//@ Keyboard.vm 60 Keyboard.readLine
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Keyboard.vm 61 Keyboard.readLine
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Keyboard.vm 62 Keyboard.readLine
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Keyboard.vm 63 Keyboard.readLine
+@$OS.ARITHMETIC_IF_4$
+D=A
+@$OS.EQ$
+0;JMP
+($OS.ARITHMETIC_IF_4$)
+//@ Keyboard.vm 64 Keyboard.readLine
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+A=A+1
+A=A+1
+M=D
+//@ Keyboard.vm 65 Keyboard.readLine
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Keyboard.vm 66 Keyboard.readLine
+@SP
+D=M-1
+A=D
+M=!M
+//@ Keyboard.vm 67 Keyboard.readLine
+@SP
+M=M-1
+A=M
+D=M
+@Keyboard.readLine$IF_TRUE0
+D;JNE
+//@ Keyboard.vm 68 Keyboard.readLine
+@Keyboard.readLine$IF_FALSE0
+0;JMP
+//@ Keyboard.vm 69 Keyboard.readLine
+(Keyboard.readLine$IF_TRUE0)
+//@ Keyboard.vm 70 Keyboard.readLine
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Keyboard.vm 71 Keyboard.readLine
+@2
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Keyboard.vm 72 Keyboard.readLine
+@$OS.ARITHMETIC_IF_5$
+D=A
+@$OS.EQ$
+0;JMP
+($OS.ARITHMETIC_IF_5$)
+//@ Keyboard.vm 73 Keyboard.readLine
+@SP
+M=M-1
+A=M
+D=M
+@Keyboard.readLine$IF_TRUE1
+D;JNE
+//@ Keyboard.vm 74 Keyboard.readLine
+@Keyboard.readLine$IF_FALSE1
+0;JMP
+//@ Keyboard.vm 75 Keyboard.readLine
+(Keyboard.readLine$IF_TRUE1)
+//@ Keyboard.vm 76 Keyboard.readLine
+@3
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Keyboard.vm 77 Keyboard.readLine
+@R13
+M=1
+@String.eraseLastChar
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_14$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_14$)
+//@ Keyboard.vm 78 Keyboard.readLine
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Keyboard.vm 79 Keyboard.readLine
+@Keyboard.readLine$IF_END1
+0;JMP
+//@ Keyboard.vm 80 Keyboard.readLine
+(Keyboard.readLine$IF_FALSE1)
+//@ Keyboard.vm 81 Keyboard.readLine
+@3
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Keyboard.vm 82 Keyboard.readLine
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Keyboard.vm 83 Keyboard.readLine
+@2
+D=A
+@R13
+M=D
+@String.appendChar
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_15$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_15$)
+//@ Keyboard.vm 84 Keyboard.readLine
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+A=A+1
+M=D
+//@ Keyboard.vm 85 Keyboard.readLine
+(Keyboard.readLine$IF_END1)
+//@ Keyboard.vm 86 Keyboard.readLine
+(Keyboard.readLine$IF_FALSE0)
+//@ Keyboard.vm 87 Keyboard.readLine
+@Keyboard.readLine$WHILE_EXP0
+0;JMP
+//@ Keyboard.vm 88 Keyboard.readLine
+(Keyboard.readLine$WHILE_END0)
+//@ Keyboard.vm 89 Keyboard.readLine
+@3
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Keyboard.vm 90 Keyboard.readLine
+@$OS.RETURN$
+0;JMP
+//@ Keyboard.vm 91 Keyboard.readInt
+(Keyboard.readInt)
+D=0
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Keyboard.vm 92 Keyboard.readInt
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Keyboard.vm 93 Keyboard.readInt
+@R13
+M=1
+@Keyboard.readLine
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_16$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_16$)
+//@ Keyboard.vm 94 Keyboard.readInt
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Keyboard.vm 95 Keyboard.readInt
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Keyboard.vm 96 Keyboard.readInt
+@R13
+M=1
+@String.intValue
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_17$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_17$)
+//@ Keyboard.vm 97 Keyboard.readInt
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+M=D
+//@ Keyboard.vm 98 Keyboard.readInt
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Keyboard.vm 99 Keyboard.readInt
+@R13
+M=1
+@String.dispose
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_18$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_18$)
+//@ Keyboard.vm 100 Keyboard.readInt
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Keyboard.vm 101 Keyboard.readInt
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Keyboard.vm 102 Keyboard.readInt
+@$OS.RETURN$
+0;JMP
+//@ Math.vm 1 Math.init
+(Math.init)
+D=0
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 2 Math.init
+@16
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 3 Math.init
+@R13
+M=1
+@Array.new
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_19$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_19$)
+//@ Math.vm 4 Math.init
+@SP
+M=M-1
+A=M
+D=M
+@Math.vm.1
+M=D
+//@ Math.vm 5 Math.init
+@16
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 6 Math.init
+@R13
+M=1
+@Array.new
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_20$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_20$)
+//@ Math.vm 7 Math.init
+@SP
+M=M-1
+A=M
+D=M
+@Math.vm.0
+M=D
+//@ Math.vm 8 Math.init
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 9 Math.init
+@Math.vm.0
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 10 Math.init
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Math.vm 11 Math.init
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 12 Math.init
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Math.vm 13 Math.init
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Math.vm 14 Math.init
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 15 Math.init
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Math.vm 16 Math.init
+(Math.init$WHILE_EXP0)
+//@ Math.vm 17 Math.init
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 18 Math.init
+@15
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 19 Math.init
+@$OS.ARITHMETIC_IF_6$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_6$)
+//@ Math.vm 20 Math.init
+@SP
+D=M-1
+A=D
+M=!M
+//@ Math.vm 21 Math.init
+@SP
+M=M-1
+A=M
+D=M
+@Math.init$WHILE_END0
+D;JNE
+//@ Math.vm 22 Math.init
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 23 Math.init
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 24 Math.init
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Math.vm 25 Math.init
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Math.vm 26 Math.init
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 27 Math.init
+@Math.vm.0
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 28 Math.init
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Math.vm 29 Math.init
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 30 Math.init
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 31 Math.init
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Math.vm 32 Math.init
+@Math.vm.0
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 33 Math.init
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Math.vm 34 Math.init
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Math.vm 35 Math.init
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 36 Math.init
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 37 Math.init
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 38 Math.init
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Math.vm 39 Math.init
+@Math.vm.0
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 40 Math.init
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Math.vm 41 Math.init
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Math.vm 42 Math.init
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 43 Math.init
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Math.vm 44 Math.init
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Math.vm 45 Math.init
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Math.vm 46 Math.init
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 47 Math.init
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Math.vm 48 Math.init
+@Math.init$WHILE_EXP0
+0;JMP
+//@ Math.vm 49 Math.init
+(Math.init$WHILE_END0)
+//@ Math.vm 50 Math.init
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 51 Math.init
+@$OS.RETURN$
+0;JMP
+//@ Math.vm 52 Math.abs
+(Math.abs)
+D=0
+//@ Math.vm 53 Math.abs
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 54 Math.abs
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 55 Math.abs
+@$OS.ARITHMETIC_IF_7$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_7$)
+//@ Math.vm 56 Math.abs
+@SP
+M=M-1
+A=M
+D=M
+@Math.abs$IF_TRUE0
+D;JNE
+//@ Math.vm 57 Math.abs
+@Math.abs$IF_FALSE0
+0;JMP
+//@ Math.vm 58 Math.abs
+(Math.abs$IF_TRUE0)
+//@ Math.vm 59 Math.abs
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 60 Math.abs
+@SP
+D=M-1
+A=D
+M=-M
+//@ Math.vm 61 Math.abs
+@SP
+M=M-1
+A=M
+D=M
+@ARG
+A=M
+M=D
+//@ Math.vm 62 Math.abs
+(Math.abs$IF_FALSE0)
+//@ Math.vm 63 Math.abs
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 64 Math.abs
+@$OS.RETURN$
+0;JMP
+//@ Math.vm 65 Math.multiply
+(Math.multiply)
+D=0
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 66 Math.multiply
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 67 Math.multiply
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 68 Math.multiply
+@$OS.ARITHMETIC_IF_8$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_8$)
+//@ Math.vm 69 Math.multiply
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 70 Math.multiply
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 71 Math.multiply
+@$OS.ARITHMETIC_IF_9$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_9$)
+//@ Math.vm 72 Math.multiply
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M&D
+//@ Math.vm 73 Math.multiply
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 74 Math.multiply
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 75 Math.multiply
+@$OS.ARITHMETIC_IF_10$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_10$)
+//@ Math.vm 76 Math.multiply
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 77 Math.multiply
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 78 Math.multiply
+@$OS.ARITHMETIC_IF_11$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_11$)
+//@ Math.vm 79 Math.multiply
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M&D
+//@ Math.vm 80 Math.multiply
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ Math.vm 81 Math.multiply
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+A=A+1
+A=A+1
+M=D
+//@ Math.vm 82 Math.multiply
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 83 Math.multiply
+@R13
+M=1
+@Math.abs
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_21$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_21$)
+//@ Math.vm 84 Math.multiply
+@SP
+M=M-1
+A=M
+D=M
+@ARG
+A=M
+M=D
+//@ Math.vm 85 Math.multiply
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 86 Math.multiply
+@R13
+M=1
+@Math.abs
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_22$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_22$)
+//@ Math.vm 87 Math.multiply
+@SP
+M=M-1
+A=M
+D=M
+@ARG
+A=M
+A=A+1
+M=D
+//@ Math.vm 88 Math.multiply
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 89 Math.multiply
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 90 Math.multiply
+@$OS.ARITHMETIC_IF_12$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_12$)
+//@ Math.vm 91 Math.multiply
+@SP
+M=M-1
+A=M
+D=M
+@Math.multiply$IF_TRUE0
+D;JNE
+//@ Math.vm 92 Math.multiply
+@Math.multiply$IF_FALSE0
+0;JMP
+//@ Math.vm 93 Math.multiply
+(Math.multiply$IF_TRUE0)
+//@ Math.vm 94 Math.multiply
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 95 Math.multiply
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+M=D
+//@ Math.vm 96 Math.multiply
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 97 Math.multiply
+@SP
+M=M-1
+A=M
+D=M
+@ARG
+A=M
+M=D
+//@ Math.vm 98 Math.multiply
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 99 Math.multiply
+@SP
+M=M-1
+A=M
+D=M
+@ARG
+A=M
+A=A+1
+M=D
+//@ Math.vm 100 Math.multiply
+(Math.multiply$IF_FALSE0)
+//@ Math.vm 101 Math.multiply
+(Math.multiply$WHILE_EXP0)
+//@ Math.vm 102 Math.multiply
+@2
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 103 Math.multiply
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 104 Math.multiply
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Math.vm 105 Math.multiply
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 106 Math.multiply
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 107 Math.multiply
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Math.vm 108 Math.multiply
+@$OS.ARITHMETIC_IF_13$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_13$)
+//@ Math.vm 109 Math.multiply
+@SP
+D=M-1
+A=D
+M=!M
+//@ Math.vm 110 Math.multiply
+@SP
+M=M-1
+A=M
+D=M
+@Math.multiply$WHILE_END0
+D;JNE
+//@ Math.vm 111 Math.multiply
+@3
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 112 Math.multiply
+@Math.vm.0
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 113 Math.multiply
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Math.vm 114 Math.multiply
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Math.vm 115 Math.multiply
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 116 Math.multiply
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 117 Math.multiply
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M&D
+//@ Math.vm 118 Math.multiply
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 119 Math.multiply
+@$OS.ARITHMETIC_IF_14$
+D=A
+@$OS.EQ$
+0;JMP
+($OS.ARITHMETIC_IF_14$)
+//@ Math.vm 120 Math.multiply
+@SP
+D=M-1
+A=D
+M=!M
+//@ Math.vm 121 Math.multiply
+@SP
+M=M-1
+A=M
+D=M
+@Math.multiply$IF_TRUE1
+D;JNE
+//@ Math.vm 122 Math.multiply
+@Math.multiply$IF_FALSE1
+0;JMP
+//@ Math.vm 123 Math.multiply
+(Math.multiply$IF_TRUE1)
+//@ Math.vm 124 Math.multiply
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 125 Math.multiply
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 126 Math.multiply
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Math.vm 127 Math.multiply
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Math.vm 128 Math.multiply
+@2
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 129 Math.multiply
+@3
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 130 Math.multiply
+@Math.vm.0
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 131 Math.multiply
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Math.vm 132 Math.multiply
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Math.vm 133 Math.multiply
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 134 Math.multiply
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Math.vm 135 Math.multiply
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+M=D
+//@ Math.vm 136 Math.multiply
+(Math.multiply$IF_FALSE1)
+//@ Math.vm 137 Math.multiply
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 138 Math.multiply
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 139 Math.multiply
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Math.vm 140 Math.multiply
+@SP
+M=M-1
+A=M
+D=M
+@ARG
+A=M
+M=D
+//@ Math.vm 141 Math.multiply
+@3
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 142 Math.multiply
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 143 Math.multiply
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Math.vm 144 Math.multiply
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+A=A+1
+M=D
+//@ Math.vm 145 Math.multiply
+@Math.multiply$WHILE_EXP0
+0;JMP
+//@ Math.vm 146 Math.multiply
+(Math.multiply$WHILE_END0)
+//@ Math.vm 147 Math.multiply
+@4
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 148 Math.multiply
+@SP
+M=M-1
+A=M
+D=M
+@Math.multiply$IF_TRUE2
+D;JNE
+//@ Math.vm 149 Math.multiply
+@Math.multiply$IF_FALSE2
+0;JMP
+//@ Math.vm 150 Math.multiply
+(Math.multiply$IF_TRUE2)
+//@ Math.vm 151 Math.multiply
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 152 Math.multiply
+@SP
+D=M-1
+A=D
+M=-M
+//@ Math.vm 153 Math.multiply
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Math.vm 154 Math.multiply
+(Math.multiply$IF_FALSE2)
+//@ Math.vm 155 Math.multiply
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 156 Math.multiply
+@$OS.RETURN$
+0;JMP
+//@ Math.vm 157 Math.divide
+(Math.divide)
+D=0
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 158 Math.divide
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 159 Math.divide
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 160 Math.divide
+@$OS.ARITHMETIC_IF_15$
+D=A
+@$OS.EQ$
+0;JMP
+($OS.ARITHMETIC_IF_15$)
+//@ Math.vm 161 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+@Math.divide$IF_TRUE0
+D;JNE
+//@ Math.vm 162 Math.divide
+@Math.divide$IF_FALSE0
+0;JMP
+//@ Math.vm 163 Math.divide
+(Math.divide$IF_TRUE0)
+//@ Math.vm 164 Math.divide
+@3
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 165 Math.divide
+@R13
+M=1
+@Sys.error
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_23$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_23$)
+//@ Math.vm 166 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Math.vm 167 Math.divide
+(Math.divide$IF_FALSE0)
+//@ Math.vm 168 Math.divide
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 169 Math.divide
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 170 Math.divide
+@$OS.ARITHMETIC_IF_16$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_16$)
+//@ Math.vm 171 Math.divide
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 172 Math.divide
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 173 Math.divide
+@$OS.ARITHMETIC_IF_17$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_17$)
+//@ Math.vm 174 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M&D
+//@ Math.vm 175 Math.divide
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 176 Math.divide
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 177 Math.divide
+@$OS.ARITHMETIC_IF_18$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_18$)
+//@ Math.vm 178 Math.divide
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 179 Math.divide
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 180 Math.divide
+@$OS.ARITHMETIC_IF_19$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_19$)
+//@ Math.vm 181 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M&D
+//@ Math.vm 182 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ Math.vm 183 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+M=D
+//@ Math.vm 184 Math.divide
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 185 Math.divide
+@Math.vm.1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 186 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Math.vm 187 Math.divide
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 188 Math.divide
+@R13
+M=1
+@Math.abs
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_24$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_24$)
+//@ Math.vm 189 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Math.vm 190 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Math.vm 191 Math.divide
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 192 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Math.vm 193 Math.divide
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 194 Math.divide
+@R13
+M=1
+@Math.abs
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_25$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_25$)
+//@ Math.vm 195 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+@ARG
+A=M
+M=D
+//@ Math.vm 196 Math.divide
+(Math.divide$WHILE_EXP0)
+//@ Math.vm 197 Math.divide
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 198 Math.divide
+@15
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 199 Math.divide
+@$OS.ARITHMETIC_IF_20$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_20$)
+//@ Math.vm 200 Math.divide
+@3
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 201 Math.divide
+@SP
+D=M-1
+A=D
+M=!M
+//@ Math.vm 202 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M&D
+//@ Math.vm 203 Math.divide
+@SP
+D=M-1
+A=D
+M=!M
+//@ Math.vm 204 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+@Math.divide$WHILE_END0
+D;JNE
+//@ Math.vm 205 Math.divide
+@32767
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 206 Math.divide
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 207 Math.divide
+@Math.vm.1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 208 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Math.vm 209 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Math.vm 210 Math.divide
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 211 Math.divide
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 212 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Math.vm 213 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Math.vm 214 Math.divide
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 215 Math.divide
+@Math.vm.1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 216 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Math.vm 217 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Math.vm 218 Math.divide
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 219 Math.divide
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 220 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Math.vm 221 Math.divide
+@$OS.ARITHMETIC_IF_21$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_21$)
+//@ Math.vm 222 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+A=A+1
+M=D
+//@ Math.vm 223 Math.divide
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 224 Math.divide
+@SP
+D=M-1
+A=D
+M=!M
+//@ Math.vm 225 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+@Math.divide$IF_TRUE1
+D;JNE
+//@ Math.vm 226 Math.divide
+@Math.divide$IF_FALSE1
+0;JMP
+//@ Math.vm 227 Math.divide
+(Math.divide$IF_TRUE1)
+//@ Math.vm 228 Math.divide
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 229 Math.divide
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 230 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Math.vm 231 Math.divide
+@Math.vm.1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 232 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Math.vm 233 Math.divide
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 234 Math.divide
+@Math.vm.1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 235 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Math.vm 236 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Math.vm 237 Math.divide
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 238 Math.divide
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 239 Math.divide
+@Math.vm.1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 240 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Math.vm 241 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Math.vm 242 Math.divide
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 243 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Math.vm 244 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Math.vm 245 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Math.vm 246 Math.divide
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 247 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Math.vm 248 Math.divide
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 249 Math.divide
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 250 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Math.vm 251 Math.divide
+@Math.vm.1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 252 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Math.vm 253 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Math.vm 254 Math.divide
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 255 Math.divide
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 256 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Math.vm 257 Math.divide
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 258 Math.divide
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 259 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Math.vm 260 Math.divide
+@$OS.ARITHMETIC_IF_22$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_22$)
+//@ Math.vm 261 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+A=A+1
+M=D
+//@ Math.vm 262 Math.divide
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 263 Math.divide
+@SP
+D=M-1
+A=D
+M=!M
+//@ Math.vm 264 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+@Math.divide$IF_TRUE2
+D;JNE
+//@ Math.vm 265 Math.divide
+@Math.divide$IF_FALSE2
+0;JMP
+//@ Math.vm 266 Math.divide
+(Math.divide$IF_TRUE2)
+//@ Math.vm 267 Math.divide
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 268 Math.divide
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 269 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Math.vm 270 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Math.vm 271 Math.divide
+(Math.divide$IF_FALSE2)
+//@ Math.vm 272 Math.divide
+(Math.divide$IF_FALSE1)
+//@ Math.vm 273 Math.divide
+@Math.divide$WHILE_EXP0
+0;JMP
+//@ Math.vm 274 Math.divide
+(Math.divide$WHILE_END0)
+//@ Math.vm 275 Math.divide
+(Math.divide$WHILE_EXP1)
+//@ Math.vm 276 Math.divide
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 277 Math.divide
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 278 Math.divide
+@SP
+D=M-1
+A=D
+M=-M
+//@ Math.vm 279 Math.divide
+@$OS.ARITHMETIC_IF_23$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_23$)
+//@ Math.vm 280 Math.divide
+@SP
+D=M-1
+A=D
+M=!M
+//@ Math.vm 281 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+@Math.divide$WHILE_END1
+D;JNE
+//@ Math.vm 282 Math.divide
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 283 Math.divide
+@Math.vm.1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 284 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Math.vm 285 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Math.vm 286 Math.divide
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 287 Math.divide
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 288 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Math.vm 289 Math.divide
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 290 Math.divide
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 291 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Math.vm 292 Math.divide
+@$OS.ARITHMETIC_IF_24$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_24$)
+//@ Math.vm 293 Math.divide
+@SP
+D=M-1
+A=D
+M=!M
+//@ Math.vm 294 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+@Math.divide$IF_TRUE3
+D;JNE
+//@ Math.vm 295 Math.divide
+@Math.divide$IF_FALSE3
+0;JMP
+//@ Math.vm 296 Math.divide
+(Math.divide$IF_TRUE3)
+//@ Math.vm 297 Math.divide
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 298 Math.divide
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 299 Math.divide
+@Math.vm.0
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 300 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Math.vm 301 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Math.vm 302 Math.divide
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 303 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Math.vm 304 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+M=D
+//@ Math.vm 305 Math.divide
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 306 Math.divide
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 307 Math.divide
+@Math.vm.1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 308 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Math.vm 309 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Math.vm 310 Math.divide
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 311 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Math.vm 312 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+@ARG
+A=M
+M=D
+//@ Math.vm 313 Math.divide
+(Math.divide$IF_FALSE3)
+//@ Math.vm 314 Math.divide
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 315 Math.divide
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 316 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Math.vm 317 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Math.vm 318 Math.divide
+@Math.divide$WHILE_EXP1
+0;JMP
+//@ Math.vm 319 Math.divide
+(Math.divide$WHILE_END1)
+//@ Math.vm 320 Math.divide
+@2
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 321 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+@Math.divide$IF_TRUE4
+D;JNE
+//@ Math.vm 322 Math.divide
+@Math.divide$IF_FALSE4
+0;JMP
+//@ Math.vm 323 Math.divide
+(Math.divide$IF_TRUE4)
+//@ Math.vm 324 Math.divide
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 325 Math.divide
+@SP
+D=M-1
+A=D
+M=-M
+//@ Math.vm 326 Math.divide
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+M=D
+//@ Math.vm 327 Math.divide
+(Math.divide$IF_FALSE4)
+//@ Math.vm 328 Math.divide
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 329 Math.divide
+@$OS.RETURN$
+0;JMP
+//@ Math.vm 330 Math.sqrt
+(Math.sqrt)
+D=0
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 331 Math.sqrt
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 332 Math.sqrt
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 333 Math.sqrt
+@$OS.ARITHMETIC_IF_25$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_25$)
+//@ Math.vm 334 Math.sqrt
+@SP
+M=M-1
+A=M
+D=M
+@Math.sqrt$IF_TRUE0
+D;JNE
+//@ Math.vm 335 Math.sqrt
+@Math.sqrt$IF_FALSE0
+0;JMP
+//@ Math.vm 336 Math.sqrt
+(Math.sqrt$IF_TRUE0)
+//@ Math.vm 337 Math.sqrt
+@4
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 338 Math.sqrt
+@R13
+M=1
+@Sys.error
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_26$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_26$)
+//@ Math.vm 339 Math.sqrt
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Math.vm 340 Math.sqrt
+(Math.sqrt$IF_FALSE0)
+//@ Math.vm 341 Math.sqrt
+@7
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 342 Math.sqrt
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Math.vm 343 Math.sqrt
+(Math.sqrt$WHILE_EXP0)
+//@ Math.vm 344 Math.sqrt
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 345 Math.sqrt
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 346 Math.sqrt
+@SP
+D=M-1
+A=D
+M=-M
+//@ Math.vm 347 Math.sqrt
+@$OS.ARITHMETIC_IF_26$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_26$)
+//@ Math.vm 348 Math.sqrt
+@SP
+D=M-1
+A=D
+M=!M
+//@ Math.vm 349 Math.sqrt
+@SP
+M=M-1
+A=M
+D=M
+@Math.sqrt$WHILE_END0
+D;JNE
+//@ Math.vm 350 Math.sqrt
+@3
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 351 Math.sqrt
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 352 Math.sqrt
+@Math.vm.0
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 353 Math.sqrt
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Math.vm 354 Math.sqrt
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Math.vm 355 Math.sqrt
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 356 Math.sqrt
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Math.vm 357 Math.sqrt
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+M=D
+//@ Math.vm 358 Math.sqrt
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 359 Math.sqrt
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 360 Math.sqrt
+@2
+D=A
+@R13
+M=D
+@Math.multiply
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_27$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_27$)
+//@ Math.vm 361 Math.sqrt
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+M=D
+//@ Math.vm 362 Math.sqrt
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 363 Math.sqrt
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 364 Math.sqrt
+@$OS.ARITHMETIC_IF_27$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_27$)
+//@ Math.vm 365 Math.sqrt
+@SP
+D=M-1
+A=D
+M=!M
+//@ Math.vm 366 Math.sqrt
+@2
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 367 Math.sqrt
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 368 Math.sqrt
+@$OS.ARITHMETIC_IF_28$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_28$)
+//@ Math.vm 369 Math.sqrt
+@SP
+D=M-1
+A=D
+M=!M
+//@ Math.vm 370 Math.sqrt
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M&D
+//@ Math.vm 371 Math.sqrt
+@SP
+M=M-1
+A=M
+D=M
+@Math.sqrt$IF_TRUE1
+D;JNE
+//@ Math.vm 372 Math.sqrt
+@Math.sqrt$IF_FALSE1
+0;JMP
+//@ Math.vm 373 Math.sqrt
+(Math.sqrt$IF_TRUE1)
+//@ Math.vm 374 Math.sqrt
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 375 Math.sqrt
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+A=A+1
+M=D
+//@ Math.vm 376 Math.sqrt
+(Math.sqrt$IF_FALSE1)
+//@ Math.vm 377 Math.sqrt
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 378 Math.sqrt
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 379 Math.sqrt
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Math.vm 380 Math.sqrt
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Math.vm 381 Math.sqrt
+@Math.sqrt$WHILE_EXP0
+0;JMP
+//@ Math.vm 382 Math.sqrt
+(Math.sqrt$WHILE_END0)
+//@ Math.vm 383 Math.sqrt
+@3
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 384 Math.sqrt
+@$OS.RETURN$
+0;JMP
+//@ Math.vm 385 Math.max
+(Math.max)
+D=0
+//@ Math.vm 386 Math.max
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 387 Math.max
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 388 Math.max
+@$OS.ARITHMETIC_IF_29$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_29$)
+//@ Math.vm 389 Math.max
+@SP
+M=M-1
+A=M
+D=M
+@Math.max$IF_TRUE0
+D;JNE
+//@ Math.vm 390 Math.max
+@Math.max$IF_FALSE0
+0;JMP
+//@ Math.vm 391 Math.max
+(Math.max$IF_TRUE0)
+//@ Math.vm 392 Math.max
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 393 Math.max
+@SP
+M=M-1
+A=M
+D=M
+@ARG
+A=M
+A=A+1
+M=D
+//@ Math.vm 394 Math.max
+(Math.max$IF_FALSE0)
+//@ Math.vm 395 Math.max
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 396 Math.max
+@$OS.RETURN$
+0;JMP
+//@ Math.vm 397 Math.min
+(Math.min)
+D=0
+//@ Math.vm 398 Math.min
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 399 Math.min
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 400 Math.min
+@$OS.ARITHMETIC_IF_30$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_30$)
+//@ Math.vm 401 Math.min
+@SP
+M=M-1
+A=M
+D=M
+@Math.min$IF_TRUE0
+D;JNE
+//@ Math.vm 402 Math.min
+@Math.min$IF_FALSE0
+0;JMP
+//@ Math.vm 403 Math.min
+(Math.min$IF_TRUE0)
+//@ Math.vm 404 Math.min
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 405 Math.min
+@SP
+M=M-1
+A=M
+D=M
+@ARG
+A=M
+A=A+1
+M=D
+//@ Math.vm 406 Math.min
+(Math.min$IF_FALSE0)
+//@ Math.vm 407 Math.min
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Math.vm 408 Math.min
+@$OS.RETURN$
+0;JMP
+//@ Memory.vm 1 Memory.init
+(Memory.init)
+D=0
+//@ Memory.vm 2 Memory.init
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 3 Memory.init
+@SP
+M=M-1
+A=M
+D=M
+@Memory.vm.0
+M=D
+//@ Memory.vm 4 Memory.init
+@2048
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 5 Memory.init
+@Memory.vm.0
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 6 Memory.init
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 7 Memory.init
+@14334
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 8 Memory.init
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Memory.vm 9 Memory.init
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 10 Memory.init
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 11 Memory.init
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Memory.vm 12 Memory.init
+@2049
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 13 Memory.init
+@Memory.vm.0
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 14 Memory.init
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 15 Memory.init
+@2050
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 16 Memory.init
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Memory.vm 17 Memory.init
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 18 Memory.init
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 19 Memory.init
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Memory.vm 20 Memory.init
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 21 Memory.init
+@$OS.RETURN$
+0;JMP
+//@ Memory.vm 22 Memory.peek
+(Memory.peek)
+D=0
+//@ Memory.vm 23 Memory.peek
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 24 Memory.peek
+@Memory.vm.0
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 25 Memory.peek
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 26 Memory.peek
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 27 Memory.peek
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 28 Memory.peek
+@$OS.RETURN$
+0;JMP
+//@ Memory.vm 29 Memory.poke
+(Memory.poke)
+D=0
+//@ Memory.vm 30 Memory.poke
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 31 Memory.poke
+@Memory.vm.0
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 32 Memory.poke
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 33 Memory.poke
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 34 Memory.poke
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Memory.vm 35 Memory.poke
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 36 Memory.poke
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 37 Memory.poke
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Memory.vm 38 Memory.poke
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 39 Memory.poke
+@$OS.RETURN$
+0;JMP
+//@ Memory.vm 40 Memory.alloc
+(Memory.alloc)
+D=0
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 41 Memory.alloc
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 42 Memory.alloc
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 43 Memory.alloc
+@$OS.ARITHMETIC_IF_31$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_31$)
+//@ Memory.vm 44 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@Memory.alloc$IF_TRUE0
+D;JNE
+//@ Memory.vm 45 Memory.alloc
+@Memory.alloc$IF_FALSE0
+0;JMP
+//@ Memory.vm 46 Memory.alloc
+(Memory.alloc$IF_TRUE0)
+//@ Memory.vm 47 Memory.alloc
+@5
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 48 Memory.alloc
+@R13
+M=1
+@Sys.error
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_28$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_28$)
+//@ Memory.vm 49 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Memory.vm 50 Memory.alloc
+(Memory.alloc$IF_FALSE0)
+//@ Memory.vm 51 Memory.alloc
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 52 Memory.alloc
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 53 Memory.alloc
+@$OS.ARITHMETIC_IF_32$
+D=A
+@$OS.EQ$
+0;JMP
+($OS.ARITHMETIC_IF_32$)
+//@ Memory.vm 54 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@Memory.alloc$IF_TRUE1
+D;JNE
+//@ Memory.vm 55 Memory.alloc
+@Memory.alloc$IF_FALSE1
+0;JMP
+//@ Memory.vm 56 Memory.alloc
+(Memory.alloc$IF_TRUE1)
+//@ Memory.vm 57 Memory.alloc
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 58 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@ARG
+A=M
+M=D
+//@ Memory.vm 59 Memory.alloc
+(Memory.alloc$IF_FALSE1)
+//@ Memory.vm 60 Memory.alloc
+@2048
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 61 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Memory.vm 62 Memory.alloc
+(Memory.alloc$WHILE_EXP0)
+//@ Memory.vm 63 Memory.alloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 64 Memory.alloc
+@16383
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 65 Memory.alloc
+@$OS.ARITHMETIC_IF_33$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_33$)
+//@ Memory.vm 66 Memory.alloc
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 67 Memory.alloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 68 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 69 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 70 Memory.alloc
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 71 Memory.alloc
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 72 Memory.alloc
+@$OS.ARITHMETIC_IF_34$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_34$)
+//@ Memory.vm 73 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M&D
+//@ Memory.vm 74 Memory.alloc
+@SP
+D=M-1
+A=D
+M=!M
+//@ Memory.vm 75 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@Memory.alloc$WHILE_END0
+D;JNE
+//@ Memory.vm 76 Memory.alloc
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 77 Memory.alloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 78 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 79 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 80 Memory.alloc
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 81 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+M=D
+//@ Memory.vm 82 Memory.alloc
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 83 Memory.alloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 84 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 85 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 86 Memory.alloc
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 87 Memory.alloc
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 88 Memory.alloc
+@$OS.ARITHMETIC_IF_35$
+D=A
+@$OS.EQ$
+0;JMP
+($OS.ARITHMETIC_IF_35$)
+//@ Memory.vm 89 Memory.alloc
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 90 Memory.alloc
+@16382
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 91 Memory.alloc
+@$OS.ARITHMETIC_IF_36$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_36$)
+//@ Memory.vm 92 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ Memory.vm 93 Memory.alloc
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 94 Memory.alloc
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 95 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 96 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 97 Memory.alloc
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 98 Memory.alloc
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 99 Memory.alloc
+@$OS.ARITHMETIC_IF_37$
+D=A
+@$OS.EQ$
+0;JMP
+($OS.ARITHMETIC_IF_37$)
+//@ Memory.vm 100 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ Memory.vm 101 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@Memory.alloc$IF_TRUE2
+D;JNE
+//@ Memory.vm 102 Memory.alloc
+@Memory.alloc$IF_FALSE2
+0;JMP
+//@ Memory.vm 103 Memory.alloc
+(Memory.alloc$IF_TRUE2)
+//@ Memory.vm 104 Memory.alloc
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 105 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Memory.vm 106 Memory.alloc
+@Memory.alloc$IF_END2
+0;JMP
+//@ Memory.vm 107 Memory.alloc
+(Memory.alloc$IF_FALSE2)
+//@ Memory.vm 108 Memory.alloc
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 109 Memory.alloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 110 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 111 Memory.alloc
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 112 Memory.alloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 113 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 114 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 115 Memory.alloc
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 116 Memory.alloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 117 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Memory.vm 118 Memory.alloc
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 119 Memory.alloc
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 120 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 121 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 122 Memory.alloc
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 123 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 124 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Memory.vm 125 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 126 Memory.alloc
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 127 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Memory.vm 128 Memory.alloc
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 129 Memory.alloc
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 130 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 131 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 132 Memory.alloc
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 133 Memory.alloc
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 134 Memory.alloc
+@2
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 135 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 136 Memory.alloc
+@$OS.ARITHMETIC_IF_38$
+D=A
+@$OS.EQ$
+0;JMP
+($OS.ARITHMETIC_IF_38$)
+//@ Memory.vm 137 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@Memory.alloc$IF_TRUE3
+D;JNE
+//@ Memory.vm 138 Memory.alloc
+@Memory.alloc$IF_FALSE3
+0;JMP
+//@ Memory.vm 139 Memory.alloc
+(Memory.alloc$IF_TRUE3)
+//@ Memory.vm 140 Memory.alloc
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 141 Memory.alloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 142 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 143 Memory.alloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 144 Memory.alloc
+@2
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 145 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 146 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Memory.vm 147 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 148 Memory.alloc
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 149 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Memory.vm 150 Memory.alloc
+@Memory.alloc$IF_END3
+0;JMP
+//@ Memory.vm 151 Memory.alloc
+(Memory.alloc$IF_FALSE3)
+//@ Memory.vm 152 Memory.alloc
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 153 Memory.alloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 154 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 155 Memory.alloc
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 156 Memory.alloc
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 157 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 158 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 159 Memory.alloc
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 160 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Memory.vm 161 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 162 Memory.alloc
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 163 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Memory.vm 164 Memory.alloc
+(Memory.alloc$IF_END3)
+//@ Memory.vm 165 Memory.alloc
+(Memory.alloc$IF_END2)
+//@ Memory.vm 166 Memory.alloc
+@Memory.alloc$WHILE_EXP0
+0;JMP
+//@ Memory.vm 167 Memory.alloc
+(Memory.alloc$WHILE_END0)
+//@ Memory.vm 168 Memory.alloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 169 Memory.alloc
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 170 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 171 Memory.alloc
+@16379
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 172 Memory.alloc
+@$OS.ARITHMETIC_IF_39$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_39$)
+//@ Memory.vm 173 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@Memory.alloc$IF_TRUE4
+D;JNE
+//@ Memory.vm 174 Memory.alloc
+@Memory.alloc$IF_FALSE4
+0;JMP
+//@ Memory.vm 175 Memory.alloc
+(Memory.alloc$IF_TRUE4)
+//@ Memory.vm 176 Memory.alloc
+@6
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 177 Memory.alloc
+@R13
+M=1
+@Sys.error
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_29$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_29$)
+//@ Memory.vm 178 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Memory.vm 179 Memory.alloc
+(Memory.alloc$IF_FALSE4)
+//@ Memory.vm 180 Memory.alloc
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 181 Memory.alloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 182 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 183 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 184 Memory.alloc
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 185 Memory.alloc
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 186 Memory.alloc
+@2
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 187 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 188 Memory.alloc
+@$OS.ARITHMETIC_IF_40$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_40$)
+//@ Memory.vm 189 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@Memory.alloc$IF_TRUE5
+D;JNE
+//@ Memory.vm 190 Memory.alloc
+@Memory.alloc$IF_FALSE5
+0;JMP
+//@ Memory.vm 191 Memory.alloc
+(Memory.alloc$IF_TRUE5)
+//@ Memory.vm 192 Memory.alloc
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 193 Memory.alloc
+@2
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 194 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 195 Memory.alloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 196 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 197 Memory.alloc
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 198 Memory.alloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 199 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 200 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 201 Memory.alloc
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 202 Memory.alloc
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 203 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Memory.vm 204 Memory.alloc
+@2
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 205 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Memory.vm 206 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Memory.vm 207 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 208 Memory.alloc
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 209 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Memory.vm 210 Memory.alloc
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 211 Memory.alloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 212 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 213 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 214 Memory.alloc
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 215 Memory.alloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 216 Memory.alloc
+@2
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 217 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 218 Memory.alloc
+@$OS.ARITHMETIC_IF_41$
+D=A
+@$OS.EQ$
+0;JMP
+($OS.ARITHMETIC_IF_41$)
+//@ Memory.vm 219 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@Memory.alloc$IF_TRUE6
+D;JNE
+//@ Memory.vm 220 Memory.alloc
+@Memory.alloc$IF_FALSE6
+0;JMP
+//@ Memory.vm 221 Memory.alloc
+(Memory.alloc$IF_TRUE6)
+//@ Memory.vm 222 Memory.alloc
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 223 Memory.alloc
+@3
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 224 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 225 Memory.alloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 226 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 227 Memory.alloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 228 Memory.alloc
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 229 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 230 Memory.alloc
+@4
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 231 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 232 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Memory.vm 233 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 234 Memory.alloc
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 235 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Memory.vm 236 Memory.alloc
+@Memory.alloc$IF_END6
+0;JMP
+//@ Memory.vm 237 Memory.alloc
+(Memory.alloc$IF_FALSE6)
+//@ Memory.vm 238 Memory.alloc
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 239 Memory.alloc
+@3
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 240 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 241 Memory.alloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 242 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 243 Memory.alloc
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 244 Memory.alloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 245 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 246 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 247 Memory.alloc
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 248 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Memory.vm 249 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 250 Memory.alloc
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 251 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Memory.vm 252 Memory.alloc
+(Memory.alloc$IF_END6)
+//@ Memory.vm 253 Memory.alloc
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 254 Memory.alloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 255 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 256 Memory.alloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 257 Memory.alloc
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 258 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 259 Memory.alloc
+@2
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 260 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 261 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Memory.vm 262 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 263 Memory.alloc
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 264 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Memory.vm 265 Memory.alloc
+(Memory.alloc$IF_FALSE5)
+//@ Memory.vm 266 Memory.alloc
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 267 Memory.alloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 268 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 269 Memory.alloc
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 270 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Memory.vm 271 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 272 Memory.alloc
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 273 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Memory.vm 274 Memory.alloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 275 Memory.alloc
+@2
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 276 Memory.alloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 277 Memory.alloc
+@$OS.RETURN$
+0;JMP
+//@ Memory.vm 278 Memory.deAlloc
+(Memory.deAlloc)
+D=0
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 279 Memory.deAlloc
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 280 Memory.deAlloc
+@2
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 281 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Memory.vm 282 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Memory.vm 283 Memory.deAlloc
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 284 Memory.deAlloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 285 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 286 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 287 Memory.deAlloc
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 288 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+M=D
+//@ Memory.vm 289 Memory.deAlloc
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 290 Memory.deAlloc
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 291 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 292 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 293 Memory.deAlloc
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 294 Memory.deAlloc
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 295 Memory.deAlloc
+@$OS.ARITHMETIC_IF_42$
+D=A
+@$OS.EQ$
+0;JMP
+($OS.ARITHMETIC_IF_42$)
+//@ Memory.vm 296 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+@Memory.deAlloc$IF_TRUE0
+D;JNE
+//@ Memory.vm 297 Memory.deAlloc
+@Memory.deAlloc$IF_FALSE0
+0;JMP
+//@ Memory.vm 298 Memory.deAlloc
+(Memory.deAlloc$IF_TRUE0)
+//@ Memory.vm 299 Memory.deAlloc
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 300 Memory.deAlloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 301 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 302 Memory.deAlloc
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 303 Memory.deAlloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 304 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 305 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 306 Memory.deAlloc
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 307 Memory.deAlloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 308 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Memory.vm 309 Memory.deAlloc
+@2
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 310 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Memory.vm 311 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Memory.vm 312 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 313 Memory.deAlloc
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 314 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Memory.vm 315 Memory.deAlloc
+@Memory.deAlloc$IF_END0
+0;JMP
+//@ Memory.vm 316 Memory.deAlloc
+(Memory.deAlloc$IF_FALSE0)
+//@ Memory.vm 317 Memory.deAlloc
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 318 Memory.deAlloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 319 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 320 Memory.deAlloc
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 321 Memory.deAlloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 322 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 323 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 324 Memory.deAlloc
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 325 Memory.deAlloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 326 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Memory.vm 327 Memory.deAlloc
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 328 Memory.deAlloc
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 329 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 330 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 331 Memory.deAlloc
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 332 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 333 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Memory.vm 334 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 335 Memory.deAlloc
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 336 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Memory.vm 337 Memory.deAlloc
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 338 Memory.deAlloc
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 339 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 340 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 341 Memory.deAlloc
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 342 Memory.deAlloc
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 343 Memory.deAlloc
+@2
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 344 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 345 Memory.deAlloc
+@$OS.ARITHMETIC_IF_43$
+D=A
+@$OS.EQ$
+0;JMP
+($OS.ARITHMETIC_IF_43$)
+//@ Memory.vm 346 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+@Memory.deAlloc$IF_TRUE1
+D;JNE
+//@ Memory.vm 347 Memory.deAlloc
+@Memory.deAlloc$IF_FALSE1
+0;JMP
+//@ Memory.vm 348 Memory.deAlloc
+(Memory.deAlloc$IF_TRUE1)
+//@ Memory.vm 349 Memory.deAlloc
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 350 Memory.deAlloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 351 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 352 Memory.deAlloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 353 Memory.deAlloc
+@2
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 354 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 355 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Memory.vm 356 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 357 Memory.deAlloc
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 358 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Memory.vm 359 Memory.deAlloc
+@Memory.deAlloc$IF_END1
+0;JMP
+//@ Memory.vm 360 Memory.deAlloc
+(Memory.deAlloc$IF_FALSE1)
+//@ Memory.vm 361 Memory.deAlloc
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 362 Memory.deAlloc
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 363 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 364 Memory.deAlloc
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 365 Memory.deAlloc
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 366 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Memory.vm 367 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 368 Memory.deAlloc
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 369 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Memory.vm 370 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Memory.vm 371 Memory.deAlloc
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 372 Memory.deAlloc
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Memory.vm 373 Memory.deAlloc
+(Memory.deAlloc$IF_END1)
+//@ Memory.vm 374 Memory.deAlloc
+(Memory.deAlloc$IF_END0)
+//@ Memory.vm 375 Memory.deAlloc
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Memory.vm 376 Memory.deAlloc
+@$OS.RETURN$
+0;JMP
+//@ Output.vm 1 Output.init
+(Output.init)
+D=0
+//@ Output.vm 2 Output.init
+@16384
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 3 Output.init
+@SP
+M=M-1
+A=M
+D=M
+@Output.vm.4
+M=D
+//@ Output.vm 4 Output.init
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 5 Output.init
+@SP
+D=M-1
+A=D
+M=!M
+//@ Output.vm 6 Output.init
+@SP
+M=M-1
+A=M
+D=M
+@Output.vm.2
+M=D
+//@ Output.vm 7 Output.init
+@32
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 8 Output.init
+@SP
+M=M-1
+A=M
+D=M
+@Output.vm.1
+M=D
+//@ Output.vm 9 Output.init
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 10 Output.init
+@SP
+M=M-1
+A=M
+D=M
+@Output.vm.0
+M=D
+//@ Output.vm 11 Output.init
+@6
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 12 Output.init
+@R13
+M=1
+@String.new
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_30$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_30$)
+//@ Output.vm 13 Output.init
+@SP
+M=M-1
+A=M
+D=M
+@Output.vm.3
+M=D
+//@ Output.vm 14 Output.init
+@R13
+M=0
+@Output.initMap
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_31$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_31$)
+//@ Output.vm 15 Output.init
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 16 Output.init
+@R13
+M=0
+@Output.createShiftedMap
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_32$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_32$)
+//@ Output.vm 17 Output.init
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 18 Output.init
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 19 Output.init
+@$OS.RETURN$
+0;JMP
+//@ Output.vm 20 Output.initMap
+(Output.initMap)
+D=0
+//@ Output.vm 21 Output.initMap
+@127
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 22 Output.initMap
+@R13
+M=1
+@Array.new
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_33$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_33$)
+//@ Output.vm 23 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@Output.vm.5
+M=D
+//@ Output.vm 24 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 25 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 26 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 27 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 28 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 29 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 30 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 31 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 32 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 33 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 34 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 35 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 36 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_34$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_34$)
+//@ Output.vm 37 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 38 Output.initMap
+@32
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 39 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 40 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 41 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 42 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 43 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 44 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 45 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 46 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 47 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 48 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 49 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 50 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_35$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_35$)
+//@ Output.vm 51 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 52 Output.initMap
+@33
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 53 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 54 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 55 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 56 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 57 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 58 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 59 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 60 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 61 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 62 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 63 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 64 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_36$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_36$)
+//@ Output.vm 65 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 66 Output.initMap
+@34
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 67 Output.initMap
+@54
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 68 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 69 Output.initMap
+@20
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 70 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 71 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 72 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 73 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 74 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 75 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 76 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 77 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 78 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_37$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_37$)
+//@ Output.vm 79 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 80 Output.initMap
+@35
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 81 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 82 Output.initMap
+@18
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 83 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 84 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 85 Output.initMap
+@18
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 86 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 87 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 88 Output.initMap
+@18
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 89 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 90 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 91 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 92 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_38$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_38$)
+//@ Output.vm 93 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 94 Output.initMap
+@36
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 95 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 96 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 97 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 98 Output.initMap
+@3
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 99 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 100 Output.initMap
+@48
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 101 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 102 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 103 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 104 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 105 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 106 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_39$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_39$)
+//@ Output.vm 107 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 108 Output.initMap
+@37
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 109 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 110 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 111 Output.initMap
+@35
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 112 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 113 Output.initMap
+@24
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 114 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 115 Output.initMap
+@6
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 116 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 117 Output.initMap
+@49
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 118 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 119 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 120 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_40$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_40$)
+//@ Output.vm 121 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 122 Output.initMap
+@38
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 123 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 124 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 125 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 126 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 127 Output.initMap
+@54
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 128 Output.initMap
+@27
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 129 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 130 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 131 Output.initMap
+@54
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 132 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 133 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 134 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_41$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_41$)
+//@ Output.vm 135 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 136 Output.initMap
+@39
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 137 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 138 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 139 Output.initMap
+@6
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 140 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 141 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 142 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 143 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 144 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 145 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 146 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 147 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 148 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_42$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_42$)
+//@ Output.vm 149 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 150 Output.initMap
+@40
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 151 Output.initMap
+@24
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 152 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 153 Output.initMap
+@6
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 154 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 155 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 156 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 157 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 158 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 159 Output.initMap
+@24
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 160 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 161 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 162 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_43$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_43$)
+//@ Output.vm 163 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 164 Output.initMap
+@41
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 165 Output.initMap
+@6
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 166 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 167 Output.initMap
+@24
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 168 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 169 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 170 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 171 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 172 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 173 Output.initMap
+@6
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 174 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 175 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 176 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_44$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_44$)
+//@ Output.vm 177 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 178 Output.initMap
+@42
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 179 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 180 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 181 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 182 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 183 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 184 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 185 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 186 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 187 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 188 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 189 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 190 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_45$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_45$)
+//@ Output.vm 191 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 192 Output.initMap
+@43
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 193 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 194 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 195 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 196 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 197 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 198 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 199 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 200 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 201 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 202 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 203 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 204 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_46$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_46$)
+//@ Output.vm 205 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 206 Output.initMap
+@44
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 207 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 208 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 209 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 210 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 211 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 212 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 213 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 214 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 215 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 216 Output.initMap
+@6
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 217 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 218 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_47$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_47$)
+//@ Output.vm 219 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 220 Output.initMap
+@45
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 221 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 222 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 223 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 224 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 225 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 226 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 227 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 228 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 229 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 230 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 231 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 232 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_48$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_48$)
+//@ Output.vm 233 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 234 Output.initMap
+@46
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 235 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 236 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 237 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 238 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 239 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 240 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 241 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 242 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 243 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 244 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 245 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 246 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_49$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_49$)
+//@ Output.vm 247 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 248 Output.initMap
+@47
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 249 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 250 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 251 Output.initMap
+@32
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 252 Output.initMap
+@48
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 253 Output.initMap
+@24
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 254 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 255 Output.initMap
+@6
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 256 Output.initMap
+@3
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 257 Output.initMap
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 258 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 259 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 260 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_50$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_50$)
+//@ Output.vm 261 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 262 Output.initMap
+@48
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 263 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 264 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 265 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 266 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 267 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 268 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 269 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 270 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 271 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 272 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 273 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 274 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_51$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_51$)
+//@ Output.vm 275 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 276 Output.initMap
+@49
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 277 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 278 Output.initMap
+@14
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 279 Output.initMap
+@15
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 280 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 281 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 282 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 283 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 284 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 285 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 286 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 287 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 288 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_52$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_52$)
+//@ Output.vm 289 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 290 Output.initMap
+@50
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 291 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 292 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 293 Output.initMap
+@48
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 294 Output.initMap
+@24
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 295 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 296 Output.initMap
+@6
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 297 Output.initMap
+@3
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 298 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 299 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 300 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 301 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 302 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_53$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_53$)
+//@ Output.vm 303 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 304 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 305 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 306 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 307 Output.initMap
+@48
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 308 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 309 Output.initMap
+@28
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 310 Output.initMap
+@48
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 311 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 312 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 313 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 314 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 315 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 316 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_54$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_54$)
+//@ Output.vm 317 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 318 Output.initMap
+@52
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 319 Output.initMap
+@16
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 320 Output.initMap
+@24
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 321 Output.initMap
+@28
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 322 Output.initMap
+@26
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 323 Output.initMap
+@25
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 324 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 325 Output.initMap
+@24
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 326 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 327 Output.initMap
+@60
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 328 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 329 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 330 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_55$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_55$)
+//@ Output.vm 331 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 332 Output.initMap
+@53
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 333 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 334 Output.initMap
+@3
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 335 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 336 Output.initMap
+@31
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 337 Output.initMap
+@48
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 338 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 339 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 340 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 341 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 342 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 343 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 344 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_56$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_56$)
+//@ Output.vm 345 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 346 Output.initMap
+@54
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 347 Output.initMap
+@28
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 348 Output.initMap
+@6
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 349 Output.initMap
+@3
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 350 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 351 Output.initMap
+@31
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 352 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 353 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 354 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 355 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 356 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 357 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 358 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_57$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_57$)
+//@ Output.vm 359 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 360 Output.initMap
+@55
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 361 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 362 Output.initMap
+@49
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 363 Output.initMap
+@48
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 364 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 365 Output.initMap
+@24
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 366 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 367 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 368 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 369 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 370 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 371 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 372 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_58$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_58$)
+//@ Output.vm 373 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 374 Output.initMap
+@56
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 375 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 376 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 377 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 378 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 379 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 380 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 381 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 382 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 383 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 384 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 385 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 386 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_59$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_59$)
+//@ Output.vm 387 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 388 Output.initMap
+@57
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 389 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 390 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 391 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 392 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 393 Output.initMap
+@62
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 394 Output.initMap
+@48
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 395 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 396 Output.initMap
+@24
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 397 Output.initMap
+@14
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 398 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 399 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 400 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_60$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_60$)
+//@ Output.vm 401 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 402 Output.initMap
+@58
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 403 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 404 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 405 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 406 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 407 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 408 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 409 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 410 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 411 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 412 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 413 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 414 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_61$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_61$)
+//@ Output.vm 415 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 416 Output.initMap
+@59
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 417 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 418 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 419 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 420 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 421 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 422 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 423 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 424 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 425 Output.initMap
+@6
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 426 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 427 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 428 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_62$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_62$)
+//@ Output.vm 429 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 430 Output.initMap
+@60
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 431 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 432 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 433 Output.initMap
+@24
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 434 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 435 Output.initMap
+@6
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 436 Output.initMap
+@3
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 437 Output.initMap
+@6
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 438 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 439 Output.initMap
+@24
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 440 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 441 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 442 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_63$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_63$)
+//@ Output.vm 443 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 444 Output.initMap
+@61
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 445 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 446 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 447 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 448 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 449 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 450 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 451 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 452 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 453 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 454 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 455 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 456 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_64$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_64$)
+//@ Output.vm 457 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 458 Output.initMap
+@62
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 459 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 460 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 461 Output.initMap
+@3
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 462 Output.initMap
+@6
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 463 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 464 Output.initMap
+@24
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 465 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 466 Output.initMap
+@6
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 467 Output.initMap
+@3
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 468 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 469 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 470 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_65$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_65$)
+//@ Output.vm 471 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 472 Output.initMap
+@64
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 473 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 474 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 475 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 476 Output.initMap
+@59
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 477 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 478 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 479 Output.initMap
+@27
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 480 Output.initMap
+@3
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 481 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 482 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 483 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 484 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_66$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_66$)
+//@ Output.vm 485 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 486 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 487 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 488 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 489 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 490 Output.initMap
+@24
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 491 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 492 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 493 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 494 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 495 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 496 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 497 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 498 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_67$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_67$)
+//@ Output.vm 499 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 500 Output.initMap
+@65
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 501 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 502 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 503 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 504 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 505 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 506 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 507 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 508 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 509 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 510 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 511 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 512 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_68$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_68$)
+//@ Output.vm 513 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 514 Output.initMap
+@66
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 515 Output.initMap
+@31
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 516 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 517 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 518 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 519 Output.initMap
+@31
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 520 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 521 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 522 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 523 Output.initMap
+@31
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 524 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 525 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 526 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_69$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_69$)
+//@ Output.vm 527 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 528 Output.initMap
+@67
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 529 Output.initMap
+@28
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 530 Output.initMap
+@54
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 531 Output.initMap
+@35
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 532 Output.initMap
+@3
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 533 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 534 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 535 Output.initMap
+@35
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 536 Output.initMap
+@54
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 537 Output.initMap
+@28
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 538 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 539 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 540 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_70$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_70$)
+//@ Output.vm 541 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 542 Output.initMap
+@68
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 543 Output.initMap
+@15
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 544 Output.initMap
+@27
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 545 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 546 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 547 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 548 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 549 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 550 Output.initMap
+@27
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 551 Output.initMap
+@15
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 552 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 553 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 554 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_71$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_71$)
+//@ Output.vm 555 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 556 Output.initMap
+@69
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 557 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 558 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 559 Output.initMap
+@35
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 560 Output.initMap
+@11
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 561 Output.initMap
+@15
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 562 Output.initMap
+@11
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 563 Output.initMap
+@35
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 564 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 565 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 566 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 567 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 568 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_72$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_72$)
+//@ Output.vm 569 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 570 Output.initMap
+@70
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 571 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 572 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 573 Output.initMap
+@35
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 574 Output.initMap
+@11
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 575 Output.initMap
+@15
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 576 Output.initMap
+@11
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 577 Output.initMap
+@3
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 578 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 579 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 580 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 581 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 582 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_73$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_73$)
+//@ Output.vm 583 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 584 Output.initMap
+@71
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 585 Output.initMap
+@28
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 586 Output.initMap
+@54
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 587 Output.initMap
+@35
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 588 Output.initMap
+@3
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 589 Output.initMap
+@59
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 590 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 591 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 592 Output.initMap
+@54
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 593 Output.initMap
+@44
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 594 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 595 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 596 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_74$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_74$)
+//@ Output.vm 597 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 598 Output.initMap
+@72
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 599 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 600 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 601 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 602 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 603 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 604 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 605 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 606 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 607 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 608 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 609 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 610 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_75$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_75$)
+//@ Output.vm 611 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 612 Output.initMap
+@73
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 613 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 614 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 615 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 616 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 617 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 618 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 619 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 620 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 621 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 622 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 623 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 624 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_76$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_76$)
+//@ Output.vm 625 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 626 Output.initMap
+@74
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 627 Output.initMap
+@60
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 628 Output.initMap
+@24
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 629 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 630 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 631 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 632 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 633 Output.initMap
+@27
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 634 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 635 Output.initMap
+@14
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 636 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 637 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 638 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_77$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_77$)
+//@ Output.vm 639 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 640 Output.initMap
+@75
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 641 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 642 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 643 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 644 Output.initMap
+@27
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 645 Output.initMap
+@15
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 646 Output.initMap
+@27
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 647 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 648 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 649 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 650 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 651 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 652 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_78$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_78$)
+//@ Output.vm 653 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 654 Output.initMap
+@76
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 655 Output.initMap
+@3
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 656 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 657 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 658 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 659 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 660 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 661 Output.initMap
+@35
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 662 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 663 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 664 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 665 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 666 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_79$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_79$)
+//@ Output.vm 667 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 668 Output.initMap
+@77
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 669 Output.initMap
+@33
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 670 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 671 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 672 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 673 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 674 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 675 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 676 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 677 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 678 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 679 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 680 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_80$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_80$)
+//@ Output.vm 681 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 682 Output.initMap
+@78
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 683 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 684 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 685 Output.initMap
+@55
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 686 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 687 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 688 Output.initMap
+@59
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 689 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 690 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 691 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 692 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 693 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 694 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_81$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_81$)
+//@ Output.vm 695 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 696 Output.initMap
+@79
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 697 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 698 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 699 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 700 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 701 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 702 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 703 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 704 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 705 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 706 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 707 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 708 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_82$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_82$)
+//@ Output.vm 709 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 710 Output.initMap
+@80
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 711 Output.initMap
+@31
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 712 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 713 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 714 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 715 Output.initMap
+@31
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 716 Output.initMap
+@3
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 717 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 718 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 719 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 720 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 721 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 722 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_83$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_83$)
+//@ Output.vm 723 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 724 Output.initMap
+@81
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 725 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 726 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 727 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 728 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 729 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 730 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 731 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 732 Output.initMap
+@59
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 733 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 734 Output.initMap
+@48
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 735 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 736 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_84$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_84$)
+//@ Output.vm 737 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 738 Output.initMap
+@82
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 739 Output.initMap
+@31
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 740 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 741 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 742 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 743 Output.initMap
+@31
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 744 Output.initMap
+@27
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 745 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 746 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 747 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 748 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 749 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 750 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_85$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_85$)
+//@ Output.vm 751 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 752 Output.initMap
+@83
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 753 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 754 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 755 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 756 Output.initMap
+@6
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 757 Output.initMap
+@28
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 758 Output.initMap
+@48
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 759 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 760 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 761 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 762 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 763 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 764 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_86$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_86$)
+//@ Output.vm 765 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 766 Output.initMap
+@84
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 767 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 768 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 769 Output.initMap
+@45
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 770 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 771 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 772 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 773 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 774 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 775 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 776 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 777 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 778 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_87$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_87$)
+//@ Output.vm 779 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 780 Output.initMap
+@85
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 781 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 782 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 783 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 784 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 785 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 786 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 787 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 788 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 789 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 790 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 791 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 792 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_88$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_88$)
+//@ Output.vm 793 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 794 Output.initMap
+@86
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 795 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 796 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 797 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 798 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 799 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 800 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 801 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 802 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 803 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 804 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 805 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 806 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_89$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_89$)
+//@ Output.vm 807 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 808 Output.initMap
+@87
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 809 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 810 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 811 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 812 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 813 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 814 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 815 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 816 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 817 Output.initMap
+@18
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 818 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 819 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 820 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_90$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_90$)
+//@ Output.vm 821 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 822 Output.initMap
+@88
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 823 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 824 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 825 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 826 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 827 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 828 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 829 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 830 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 831 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 832 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 833 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 834 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_91$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_91$)
+//@ Output.vm 835 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 836 Output.initMap
+@89
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 837 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 838 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 839 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 840 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 841 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 842 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 843 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 844 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 845 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 846 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 847 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 848 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_92$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_92$)
+//@ Output.vm 849 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 850 Output.initMap
+@90
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 851 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 852 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 853 Output.initMap
+@49
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 854 Output.initMap
+@24
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 855 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 856 Output.initMap
+@6
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 857 Output.initMap
+@35
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 858 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 859 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 860 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 861 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 862 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_93$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_93$)
+//@ Output.vm 863 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 864 Output.initMap
+@91
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 865 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 866 Output.initMap
+@6
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 867 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 868 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 869 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 870 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 871 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 872 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 873 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 874 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 875 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 876 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_94$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_94$)
+//@ Output.vm 877 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 878 Output.initMap
+@92
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 879 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 880 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 881 Output.initMap
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 882 Output.initMap
+@3
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 883 Output.initMap
+@6
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 884 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 885 Output.initMap
+@24
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 886 Output.initMap
+@48
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 887 Output.initMap
+@32
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 888 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 889 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 890 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_95$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_95$)
+//@ Output.vm 891 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 892 Output.initMap
+@93
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 893 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 894 Output.initMap
+@24
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 895 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 896 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 897 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 898 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 899 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 900 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 901 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 902 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 903 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 904 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_96$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_96$)
+//@ Output.vm 905 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 906 Output.initMap
+@94
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 907 Output.initMap
+@8
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 908 Output.initMap
+@28
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 909 Output.initMap
+@54
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 910 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 911 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 912 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 913 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 914 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 915 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 916 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 917 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 918 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_97$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_97$)
+//@ Output.vm 919 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 920 Output.initMap
+@95
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 921 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 922 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 923 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 924 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 925 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 926 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 927 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 928 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 929 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 930 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 931 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 932 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_98$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_98$)
+//@ Output.vm 933 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 934 Output.initMap
+@96
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 935 Output.initMap
+@6
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 936 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 937 Output.initMap
+@24
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 938 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 939 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 940 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 941 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 942 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 943 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 944 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 945 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 946 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_99$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_99$)
+//@ Output.vm 947 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 948 Output.initMap
+@97
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 949 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 950 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 951 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 952 Output.initMap
+@14
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 953 Output.initMap
+@24
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 954 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 955 Output.initMap
+@27
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 956 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 957 Output.initMap
+@54
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 958 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 959 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 960 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_100$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_100$)
+//@ Output.vm 961 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 962 Output.initMap
+@98
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 963 Output.initMap
+@3
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 964 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 965 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 966 Output.initMap
+@15
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 967 Output.initMap
+@27
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 968 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 969 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 970 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 971 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 972 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 973 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 974 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_101$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_101$)
+//@ Output.vm 975 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 976 Output.initMap
+@99
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 977 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 978 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 979 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 980 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 981 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 982 Output.initMap
+@3
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 983 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 984 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 985 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 986 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 987 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 988 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_102$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_102$)
+//@ Output.vm 989 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 990 Output.initMap
+@100
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 991 Output.initMap
+@48
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 992 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 993 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 994 Output.initMap
+@60
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 995 Output.initMap
+@54
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 996 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 997 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 998 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 999 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1000 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1001 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1002 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_103$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_103$)
+//@ Output.vm 1003 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1004 Output.initMap
+@101
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1005 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1006 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1007 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1008 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1009 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1010 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1011 Output.initMap
+@3
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1012 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1013 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1014 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1015 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1016 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_104$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_104$)
+//@ Output.vm 1017 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1018 Output.initMap
+@102
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1019 Output.initMap
+@28
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1020 Output.initMap
+@54
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1021 Output.initMap
+@38
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1022 Output.initMap
+@6
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1023 Output.initMap
+@15
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1024 Output.initMap
+@6
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1025 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1026 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1027 Output.initMap
+@15
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1028 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1029 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1030 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_105$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_105$)
+//@ Output.vm 1031 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1032 Output.initMap
+@103
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1033 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1034 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1035 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1036 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1037 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1038 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1039 Output.initMap
+@62
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1040 Output.initMap
+@48
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1041 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1042 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1043 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1044 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_106$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_106$)
+//@ Output.vm 1045 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1046 Output.initMap
+@104
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1047 Output.initMap
+@3
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1048 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1049 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1050 Output.initMap
+@27
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1051 Output.initMap
+@55
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1052 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1053 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1054 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1055 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1056 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1057 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1058 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_107$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_107$)
+//@ Output.vm 1059 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1060 Output.initMap
+@105
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1061 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1062 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1063 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1064 Output.initMap
+@14
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1065 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1066 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1067 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1068 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1069 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1070 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1071 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1072 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_108$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_108$)
+//@ Output.vm 1073 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1074 Output.initMap
+@106
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1075 Output.initMap
+@48
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1076 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1077 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1078 Output.initMap
+@56
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1079 Output.initMap
+@48
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1080 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1081 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1082 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1083 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1084 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1085 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1086 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_109$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_109$)
+//@ Output.vm 1087 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1088 Output.initMap
+@107
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1089 Output.initMap
+@3
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1090 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1091 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1092 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1093 Output.initMap
+@27
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1094 Output.initMap
+@15
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1095 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1096 Output.initMap
+@27
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1097 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1098 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1099 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1100 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_110$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_110$)
+//@ Output.vm 1101 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1102 Output.initMap
+@108
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1103 Output.initMap
+@14
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1104 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1105 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1106 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1107 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1108 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1109 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1110 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1111 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1112 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1113 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1114 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_111$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_111$)
+//@ Output.vm 1115 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1116 Output.initMap
+@109
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1117 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1118 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1119 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1120 Output.initMap
+@29
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1121 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1122 Output.initMap
+@43
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1123 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1124 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1125 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1126 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1127 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1128 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_112$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_112$)
+//@ Output.vm 1129 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1130 Output.initMap
+@110
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1131 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1132 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1133 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1134 Output.initMap
+@29
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1135 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1136 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1137 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1138 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1139 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1140 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1141 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1142 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_113$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_113$)
+//@ Output.vm 1143 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1144 Output.initMap
+@111
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1145 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1146 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1147 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1148 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1149 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1150 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1151 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1152 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1153 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1154 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1155 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1156 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_114$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_114$)
+//@ Output.vm 1157 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1158 Output.initMap
+@112
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1159 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1160 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1161 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1162 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1163 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1164 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1165 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1166 Output.initMap
+@31
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1167 Output.initMap
+@3
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1168 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1169 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1170 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_115$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_115$)
+//@ Output.vm 1171 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1172 Output.initMap
+@113
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1173 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1174 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1175 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1176 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1177 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1178 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1179 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1180 Output.initMap
+@62
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1181 Output.initMap
+@48
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1182 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1183 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1184 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_116$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_116$)
+//@ Output.vm 1185 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1186 Output.initMap
+@114
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1187 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1188 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1189 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1190 Output.initMap
+@29
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1191 Output.initMap
+@55
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1192 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1193 Output.initMap
+@3
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1194 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1195 Output.initMap
+@7
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1196 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1197 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1198 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_117$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_117$)
+//@ Output.vm 1199 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1200 Output.initMap
+@115
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1201 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1202 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1203 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1204 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1205 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1206 Output.initMap
+@6
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1207 Output.initMap
+@24
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1208 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1209 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1210 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1211 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1212 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_118$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_118$)
+//@ Output.vm 1213 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1214 Output.initMap
+@116
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1215 Output.initMap
+@4
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1216 Output.initMap
+@6
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1217 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1218 Output.initMap
+@15
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1219 Output.initMap
+@6
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1220 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1221 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1222 Output.initMap
+@54
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1223 Output.initMap
+@28
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1224 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1225 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1226 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_119$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_119$)
+//@ Output.vm 1227 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1228 Output.initMap
+@117
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1229 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1230 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1231 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1232 Output.initMap
+@27
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1233 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1234 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1235 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1236 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1237 Output.initMap
+@54
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1238 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1239 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1240 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_120$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_120$)
+//@ Output.vm 1241 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1242 Output.initMap
+@118
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1243 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1244 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1245 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1246 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1247 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1248 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1249 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1250 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1251 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1252 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1253 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1254 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_121$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_121$)
+//@ Output.vm 1255 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1256 Output.initMap
+@119
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1257 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1258 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1259 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1260 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1261 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1262 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1263 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1264 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1265 Output.initMap
+@18
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1266 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1267 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1268 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_122$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_122$)
+//@ Output.vm 1269 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1270 Output.initMap
+@120
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1271 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1272 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1273 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1274 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1275 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1276 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1277 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1278 Output.initMap
+@30
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1279 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1280 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1281 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1282 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_123$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_123$)
+//@ Output.vm 1283 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1284 Output.initMap
+@121
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1285 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1286 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1287 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1288 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1289 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1290 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1291 Output.initMap
+@62
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1292 Output.initMap
+@48
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1293 Output.initMap
+@24
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1294 Output.initMap
+@15
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1295 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1296 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_124$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_124$)
+//@ Output.vm 1297 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1298 Output.initMap
+@122
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1299 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1300 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1301 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1302 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1303 Output.initMap
+@27
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1304 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1305 Output.initMap
+@6
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1306 Output.initMap
+@51
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1307 Output.initMap
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1308 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1309 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1310 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_125$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_125$)
+//@ Output.vm 1311 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1312 Output.initMap
+@123
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1313 Output.initMap
+@56
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1314 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1315 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1316 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1317 Output.initMap
+@7
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1318 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1319 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1320 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1321 Output.initMap
+@56
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1322 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1323 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1324 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_126$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_126$)
+//@ Output.vm 1325 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1326 Output.initMap
+@124
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1327 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1328 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1329 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1330 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1331 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1332 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1333 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1334 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1335 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1336 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1337 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1338 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_127$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_127$)
+//@ Output.vm 1339 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1340 Output.initMap
+@125
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1341 Output.initMap
+@7
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1342 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1343 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1344 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1345 Output.initMap
+@56
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1346 Output.initMap
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1347 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1348 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1349 Output.initMap
+@7
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1350 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1351 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1352 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_128$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_128$)
+//@ Output.vm 1353 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1354 Output.initMap
+@126
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1355 Output.initMap
+@38
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1356 Output.initMap
+@45
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1357 Output.initMap
+@25
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1358 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1359 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1360 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1361 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1362 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1363 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1364 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1365 Output.initMap
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1366 Output.initMap
+@12
+D=A
+@R13
+M=D
+@Output.create
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_129$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_129$)
+//@ Output.vm 1367 Output.initMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1368 Output.initMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1369 Output.initMap
+@$OS.RETURN$
+0;JMP
+//@ Output.vm 1370 Output.create
+(Output.create)
+D=0
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1371 Output.create
+@11
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1372 Output.create
+@R13
+M=1
+@Array.new
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_130$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_130$)
+//@ Output.vm 1373 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Output.vm 1374 Output.create
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1375 Output.create
+@Output.vm.5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1376 Output.create
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Output.vm 1377 Output.create
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1378 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1379 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Output.vm 1380 Output.create
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1381 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Output.vm 1382 Output.create
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1383 Output.create
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1384 Output.create
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Output.vm 1385 Output.create
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1386 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1387 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Output.vm 1388 Output.create
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1389 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Output.vm 1390 Output.create
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1391 Output.create
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1392 Output.create
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Output.vm 1393 Output.create
+@2
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1394 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1395 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Output.vm 1396 Output.create
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1397 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Output.vm 1398 Output.create
+@2
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1399 Output.create
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1400 Output.create
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Output.vm 1401 Output.create
+@3
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1402 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1403 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Output.vm 1404 Output.create
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1405 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Output.vm 1406 Output.create
+@3
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1407 Output.create
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1408 Output.create
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Output.vm 1409 Output.create
+@4
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1410 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1411 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Output.vm 1412 Output.create
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1413 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Output.vm 1414 Output.create
+@4
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1415 Output.create
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1416 Output.create
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Output.vm 1417 Output.create
+@5
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1418 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1419 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Output.vm 1420 Output.create
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1421 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Output.vm 1422 Output.create
+@5
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1423 Output.create
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1424 Output.create
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Output.vm 1425 Output.create
+@6
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1426 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1427 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Output.vm 1428 Output.create
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1429 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Output.vm 1430 Output.create
+@6
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1431 Output.create
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1432 Output.create
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Output.vm 1433 Output.create
+@7
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1434 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1435 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Output.vm 1436 Output.create
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1437 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Output.vm 1438 Output.create
+@7
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1439 Output.create
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1440 Output.create
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Output.vm 1441 Output.create
+@8
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1442 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1443 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Output.vm 1444 Output.create
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1445 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Output.vm 1446 Output.create
+@8
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1447 Output.create
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1448 Output.create
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Output.vm 1449 Output.create
+@9
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1450 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1451 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Output.vm 1452 Output.create
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1453 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Output.vm 1454 Output.create
+@9
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1455 Output.create
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1456 Output.create
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Output.vm 1457 Output.create
+@10
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1458 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1459 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Output.vm 1460 Output.create
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1461 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Output.vm 1462 Output.create
+@10
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1463 Output.create
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1464 Output.create
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Output.vm 1465 Output.create
+@11
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1466 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1467 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Output.vm 1468 Output.create
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1469 Output.create
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Output.vm 1470 Output.create
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1471 Output.create
+@$OS.RETURN$
+0;JMP
+//@ Output.vm 1472 Output.createShiftedMap
+(Output.createShiftedMap)
+D=0
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1473 Output.createShiftedMap
+@127
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1474 Output.createShiftedMap
+@R13
+M=1
+@Array.new
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_131$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_131$)
+//@ Output.vm 1475 Output.createShiftedMap
+@SP
+M=M-1
+A=M
+D=M
+@Output.vm.6
+M=D
+//@ Output.vm 1476 Output.createShiftedMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1477 Output.createShiftedMap
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+M=D
+//@ Output.vm 1478 Output.createShiftedMap
+(Output.createShiftedMap$WHILE_EXP0)
+//@ Output.vm 1479 Output.createShiftedMap
+@2
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1480 Output.createShiftedMap
+@127
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1481 Output.createShiftedMap
+@$OS.ARITHMETIC_IF_44$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_44$)
+//@ Output.vm 1482 Output.createShiftedMap
+@SP
+D=M-1
+A=D
+M=!M
+//@ Output.vm 1483 Output.createShiftedMap
+@SP
+M=M-1
+A=M
+D=M
+@Output.createShiftedMap$WHILE_END0
+D;JNE
+//@ Output.vm 1484 Output.createShiftedMap
+@2
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1485 Output.createShiftedMap
+@Output.vm.5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1486 Output.createShiftedMap
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Output.vm 1487 Output.createShiftedMap
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Output.vm 1488 Output.createShiftedMap
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1489 Output.createShiftedMap
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Output.vm 1490 Output.createShiftedMap
+@11
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1491 Output.createShiftedMap
+@R13
+M=1
+@Array.new
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_132$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_132$)
+//@ Output.vm 1492 Output.createShiftedMap
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+M=D
+//@ Output.vm 1493 Output.createShiftedMap
+@2
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1494 Output.createShiftedMap
+@Output.vm.6
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1495 Output.createShiftedMap
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Output.vm 1496 Output.createShiftedMap
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1497 Output.createShiftedMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1498 Output.createShiftedMap
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Output.vm 1499 Output.createShiftedMap
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1500 Output.createShiftedMap
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Output.vm 1501 Output.createShiftedMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1502 Output.createShiftedMap
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+A=A+1
+M=D
+//@ Output.vm 1503 Output.createShiftedMap
+(Output.createShiftedMap$WHILE_EXP1)
+//@ Output.vm 1504 Output.createShiftedMap
+@3
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1505 Output.createShiftedMap
+@11
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1506 Output.createShiftedMap
+@$OS.ARITHMETIC_IF_45$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_45$)
+//@ Output.vm 1507 Output.createShiftedMap
+@SP
+D=M-1
+A=D
+M=!M
+//@ Output.vm 1508 Output.createShiftedMap
+@SP
+M=M-1
+A=M
+D=M
+@Output.createShiftedMap$WHILE_END1
+D;JNE
+//@ Output.vm 1509 Output.createShiftedMap
+@3
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1510 Output.createShiftedMap
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1511 Output.createShiftedMap
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Output.vm 1512 Output.createShiftedMap
+@3
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1513 Output.createShiftedMap
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1514 Output.createShiftedMap
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Output.vm 1515 Output.createShiftedMap
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Output.vm 1516 Output.createShiftedMap
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1517 Output.createShiftedMap
+@256
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1518 Output.createShiftedMap
+@2
+D=A
+@R13
+M=D
+@Math.multiply
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_133$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_133$)
+//@ Output.vm 1519 Output.createShiftedMap
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1520 Output.createShiftedMap
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Output.vm 1521 Output.createShiftedMap
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1522 Output.createShiftedMap
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Output.vm 1523 Output.createShiftedMap
+@3
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1524 Output.createShiftedMap
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1525 Output.createShiftedMap
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Output.vm 1526 Output.createShiftedMap
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+A=A+1
+M=D
+//@ Output.vm 1527 Output.createShiftedMap
+@Output.createShiftedMap$WHILE_EXP1
+0;JMP
+//@ Output.vm 1528 Output.createShiftedMap
+(Output.createShiftedMap$WHILE_END1)
+//@ Output.vm 1529 Output.createShiftedMap
+@2
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1530 Output.createShiftedMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1531 Output.createShiftedMap
+@$OS.ARITHMETIC_IF_46$
+D=A
+@$OS.EQ$
+0;JMP
+($OS.ARITHMETIC_IF_46$)
+//@ Output.vm 1532 Output.createShiftedMap
+@SP
+M=M-1
+A=M
+D=M
+@Output.createShiftedMap$IF_TRUE0
+D;JNE
+//@ Output.vm 1533 Output.createShiftedMap
+@Output.createShiftedMap$IF_FALSE0
+0;JMP
+//@ Output.vm 1534 Output.createShiftedMap
+(Output.createShiftedMap$IF_TRUE0)
+//@ Output.vm 1535 Output.createShiftedMap
+@32
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1536 Output.createShiftedMap
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+M=D
+//@ Output.vm 1537 Output.createShiftedMap
+@Output.createShiftedMap$IF_END0
+0;JMP
+//@ Output.vm 1538 Output.createShiftedMap
+(Output.createShiftedMap$IF_FALSE0)
+//@ Output.vm 1539 Output.createShiftedMap
+@2
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1540 Output.createShiftedMap
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1541 Output.createShiftedMap
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Output.vm 1542 Output.createShiftedMap
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+M=D
+//@ Output.vm 1543 Output.createShiftedMap
+(Output.createShiftedMap$IF_END0)
+//@ Output.vm 1544 Output.createShiftedMap
+@Output.createShiftedMap$WHILE_EXP0
+0;JMP
+//@ Output.vm 1545 Output.createShiftedMap
+(Output.createShiftedMap$WHILE_END0)
+//@ Output.vm 1546 Output.createShiftedMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1547 Output.createShiftedMap
+@$OS.RETURN$
+0;JMP
+//@ Output.vm 1548 Output.getMap
+(Output.getMap)
+D=0
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1549 Output.getMap
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1550 Output.getMap
+@32
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1551 Output.getMap
+@$OS.ARITHMETIC_IF_47$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_47$)
+//@ Output.vm 1552 Output.getMap
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1553 Output.getMap
+@126
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1554 Output.getMap
+@$OS.ARITHMETIC_IF_48$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_48$)
+//@ Output.vm 1555 Output.getMap
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ Output.vm 1556 Output.getMap
+@SP
+M=M-1
+A=M
+D=M
+@Output.getMap$IF_TRUE0
+D;JNE
+//@ Output.vm 1557 Output.getMap
+@Output.getMap$IF_FALSE0
+0;JMP
+//@ Output.vm 1558 Output.getMap
+(Output.getMap$IF_TRUE0)
+//@ Output.vm 1559 Output.getMap
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1560 Output.getMap
+@SP
+M=M-1
+A=M
+D=M
+@ARG
+A=M
+M=D
+//@ Output.vm 1561 Output.getMap
+(Output.getMap$IF_FALSE0)
+//@ Output.vm 1562 Output.getMap
+@Output.vm.2
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1563 Output.getMap
+@SP
+M=M-1
+A=M
+D=M
+@Output.getMap$IF_TRUE1
+D;JNE
+//@ Output.vm 1564 Output.getMap
+@Output.getMap$IF_FALSE1
+0;JMP
+//@ Output.vm 1565 Output.getMap
+(Output.getMap$IF_TRUE1)
+//@ Output.vm 1566 Output.getMap
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1567 Output.getMap
+@Output.vm.5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1568 Output.getMap
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Output.vm 1569 Output.getMap
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Output.vm 1570 Output.getMap
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1571 Output.getMap
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Output.vm 1572 Output.getMap
+@Output.getMap$IF_END1
+0;JMP
+//@ Output.vm 1573 Output.getMap
+(Output.getMap$IF_FALSE1)
+//@ Output.vm 1574 Output.getMap
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1575 Output.getMap
+@Output.vm.6
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1576 Output.getMap
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Output.vm 1577 Output.getMap
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Output.vm 1578 Output.getMap
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1579 Output.getMap
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Output.vm 1580 Output.getMap
+(Output.getMap$IF_END1)
+//@ Output.vm 1581 Output.getMap
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1582 Output.getMap
+@$OS.RETURN$
+0;JMP
+//@ Output.vm 1583 Output.drawChar
+(Output.drawChar)
+D=0
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1584 Output.drawChar
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1585 Output.drawChar
+@R13
+M=1
+@Output.getMap
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_134$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_134$)
+//@ Output.vm 1586 Output.drawChar
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+M=D
+//@ Output.vm 1587 Output.drawChar
+@Output.vm.1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1588 Output.drawChar
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Output.vm 1589 Output.drawChar
+(Output.drawChar$WHILE_EXP0)
+//@ Output.vm 1590 Output.drawChar
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1591 Output.drawChar
+@11
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1592 Output.drawChar
+@$OS.ARITHMETIC_IF_49$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_49$)
+//@ Output.vm 1593 Output.drawChar
+@SP
+D=M-1
+A=D
+M=!M
+//@ Output.vm 1594 Output.drawChar
+@SP
+M=M-1
+A=M
+D=M
+@Output.drawChar$WHILE_END0
+D;JNE
+//@ Output.vm 1595 Output.drawChar
+@Output.vm.2
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1596 Output.drawChar
+@SP
+M=M-1
+A=M
+D=M
+@Output.drawChar$IF_TRUE0
+D;JNE
+//@ Output.vm 1597 Output.drawChar
+@Output.drawChar$IF_FALSE0
+0;JMP
+//@ Output.vm 1598 Output.drawChar
+(Output.drawChar$IF_TRUE0)
+//@ Output.vm 1599 Output.drawChar
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1600 Output.drawChar
+@Output.vm.4
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1601 Output.drawChar
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Output.vm 1602 Output.drawChar
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Output.vm 1603 Output.drawChar
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1604 Output.drawChar
+@256
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1605 Output.drawChar
+@SP
+D=M-1
+A=D
+M=-M
+//@ Output.vm 1606 Output.drawChar
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M&D
+//@ Output.vm 1607 Output.drawChar
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+A=A+1
+M=D
+//@ Output.vm 1608 Output.drawChar
+@Output.drawChar$IF_END0
+0;JMP
+//@ Output.vm 1609 Output.drawChar
+(Output.drawChar$IF_FALSE0)
+//@ Output.vm 1610 Output.drawChar
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1611 Output.drawChar
+@Output.vm.4
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1612 Output.drawChar
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Output.vm 1613 Output.drawChar
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Output.vm 1614 Output.drawChar
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1615 Output.drawChar
+@255
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1616 Output.drawChar
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M&D
+//@ Output.vm 1617 Output.drawChar
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+A=A+1
+M=D
+//@ Output.vm 1618 Output.drawChar
+(Output.drawChar$IF_END0)
+//@ Output.vm 1619 Output.drawChar
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1620 Output.drawChar
+@Output.vm.4
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1621 Output.drawChar
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Output.vm 1622 Output.drawChar
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1623 Output.drawChar
+@2
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1624 Output.drawChar
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Output.vm 1625 Output.drawChar
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Output.vm 1626 Output.drawChar
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1627 Output.drawChar
+@3
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1628 Output.drawChar
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ Output.vm 1629 Output.drawChar
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1630 Output.drawChar
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Output.vm 1631 Output.drawChar
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1632 Output.drawChar
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Output.vm 1633 Output.drawChar
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1634 Output.drawChar
+@32
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1635 Output.drawChar
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Output.vm 1636 Output.drawChar
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Output.vm 1637 Output.drawChar
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1638 Output.drawChar
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1639 Output.drawChar
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Output.vm 1640 Output.drawChar
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+M=D
+//@ Output.vm 1641 Output.drawChar
+@Output.drawChar$WHILE_EXP0
+0;JMP
+//@ Output.vm 1642 Output.drawChar
+(Output.drawChar$WHILE_END0)
+//@ Output.vm 1643 Output.drawChar
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1644 Output.drawChar
+@$OS.RETURN$
+0;JMP
+//@ Output.vm 1645 Output.moveCursor
+(Output.moveCursor)
+D=0
+//@ Output.vm 1646 Output.moveCursor
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1647 Output.moveCursor
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1648 Output.moveCursor
+@$OS.ARITHMETIC_IF_50$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_50$)
+//@ Output.vm 1649 Output.moveCursor
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1650 Output.moveCursor
+@22
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1651 Output.moveCursor
+@$OS.ARITHMETIC_IF_51$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_51$)
+//@ Output.vm 1652 Output.moveCursor
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ Output.vm 1653 Output.moveCursor
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1654 Output.moveCursor
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1655 Output.moveCursor
+@$OS.ARITHMETIC_IF_52$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_52$)
+//@ Output.vm 1656 Output.moveCursor
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ Output.vm 1657 Output.moveCursor
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1658 Output.moveCursor
+@63
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1659 Output.moveCursor
+@$OS.ARITHMETIC_IF_53$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_53$)
+//@ Output.vm 1660 Output.moveCursor
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ Output.vm 1661 Output.moveCursor
+@SP
+M=M-1
+A=M
+D=M
+@Output.moveCursor$IF_TRUE0
+D;JNE
+//@ Output.vm 1662 Output.moveCursor
+@Output.moveCursor$IF_FALSE0
+0;JMP
+//@ Output.vm 1663 Output.moveCursor
+(Output.moveCursor$IF_TRUE0)
+//@ Output.vm 1664 Output.moveCursor
+@20
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1665 Output.moveCursor
+@R13
+M=1
+@Sys.error
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_135$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_135$)
+//@ Output.vm 1666 Output.moveCursor
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1667 Output.moveCursor
+(Output.moveCursor$IF_FALSE0)
+//@ Output.vm 1668 Output.moveCursor
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1669 Output.moveCursor
+@2
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1670 Output.moveCursor
+@2
+D=A
+@R13
+M=D
+@Math.divide
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_136$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_136$)
+//@ Output.vm 1671 Output.moveCursor
+@SP
+M=M-1
+A=M
+D=M
+@Output.vm.0
+M=D
+//@ Output.vm 1672 Output.moveCursor
+@32
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1673 Output.moveCursor
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1674 Output.moveCursor
+@352
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1675 Output.moveCursor
+@2
+D=A
+@R13
+M=D
+@Math.multiply
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_137$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_137$)
+//@ Output.vm 1676 Output.moveCursor
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Output.vm 1677 Output.moveCursor
+@Output.vm.0
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1678 Output.moveCursor
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Output.vm 1679 Output.moveCursor
+@SP
+M=M-1
+A=M
+D=M
+@Output.vm.1
+M=D
+//@ Output.vm 1680 Output.moveCursor
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1681 Output.moveCursor
+@Output.vm.0
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1682 Output.moveCursor
+@2
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1683 Output.moveCursor
+@2
+D=A
+@R13
+M=D
+@Math.multiply
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_138$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_138$)
+//@ Output.vm 1684 Output.moveCursor
+@$OS.ARITHMETIC_IF_54$
+D=A
+@$OS.EQ$
+0;JMP
+($OS.ARITHMETIC_IF_54$)
+//@ Output.vm 1685 Output.moveCursor
+@SP
+M=M-1
+A=M
+D=M
+@Output.vm.2
+M=D
+//@ Output.vm 1686 Output.moveCursor
+@32
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1687 Output.moveCursor
+@R13
+M=1
+@Output.drawChar
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_139$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_139$)
+//@ Output.vm 1688 Output.moveCursor
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1689 Output.moveCursor
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1690 Output.moveCursor
+@$OS.RETURN$
+0;JMP
+//@ Output.vm 1691 Output.printChar
+(Output.printChar)
+D=0
+//@ Output.vm 1692 Output.printChar
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1693 Output.printChar
+@R13
+M=0
+@String.newLine
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_140$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_140$)
+//@ Output.vm 1694 Output.printChar
+@$OS.ARITHMETIC_IF_55$
+D=A
+@$OS.EQ$
+0;JMP
+($OS.ARITHMETIC_IF_55$)
+//@ Output.vm 1695 Output.printChar
+@SP
+M=M-1
+A=M
+D=M
+@Output.printChar$IF_TRUE0
+D;JNE
+//@ Output.vm 1696 Output.printChar
+@Output.printChar$IF_FALSE0
+0;JMP
+//@ Output.vm 1697 Output.printChar
+(Output.printChar$IF_TRUE0)
+//@ Output.vm 1698 Output.printChar
+@R13
+M=0
+@Output.println
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_141$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_141$)
+//@ Output.vm 1699 Output.printChar
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1700 Output.printChar
+@Output.printChar$IF_END0
+0;JMP
+//@ Output.vm 1701 Output.printChar
+(Output.printChar$IF_FALSE0)
+//@ Output.vm 1702 Output.printChar
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1703 Output.printChar
+@R13
+M=0
+@String.backSpace
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_142$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_142$)
+//@ Output.vm 1704 Output.printChar
+@$OS.ARITHMETIC_IF_56$
+D=A
+@$OS.EQ$
+0;JMP
+($OS.ARITHMETIC_IF_56$)
+//@ Output.vm 1705 Output.printChar
+@SP
+M=M-1
+A=M
+D=M
+@Output.printChar$IF_TRUE1
+D;JNE
+//@ Output.vm 1706 Output.printChar
+@Output.printChar$IF_FALSE1
+0;JMP
+//@ Output.vm 1707 Output.printChar
+(Output.printChar$IF_TRUE1)
+//@ Output.vm 1708 Output.printChar
+@R13
+M=0
+@Output.backSpace
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_143$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_143$)
+//@ Output.vm 1709 Output.printChar
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1710 Output.printChar
+@Output.printChar$IF_END1
+0;JMP
+//@ Output.vm 1711 Output.printChar
+(Output.printChar$IF_FALSE1)
+//@ Output.vm 1712 Output.printChar
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1713 Output.printChar
+@R13
+M=1
+@Output.drawChar
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_144$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_144$)
+//@ Output.vm 1714 Output.printChar
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1715 Output.printChar
+@Output.vm.2
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1716 Output.printChar
+@SP
+D=M-1
+A=D
+M=!M
+//@ Output.vm 1717 Output.printChar
+@SP
+M=M-1
+A=M
+D=M
+@Output.printChar$IF_TRUE2
+D;JNE
+//@ Output.vm 1718 Output.printChar
+@Output.printChar$IF_FALSE2
+0;JMP
+//@ Output.vm 1719 Output.printChar
+(Output.printChar$IF_TRUE2)
+//@ Output.vm 1720 Output.printChar
+@Output.vm.0
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1721 Output.printChar
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1722 Output.printChar
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Output.vm 1723 Output.printChar
+@SP
+M=M-1
+A=M
+D=M
+@Output.vm.0
+M=D
+//@ Output.vm 1724 Output.printChar
+@Output.vm.1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1725 Output.printChar
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1726 Output.printChar
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Output.vm 1727 Output.printChar
+@SP
+M=M-1
+A=M
+D=M
+@Output.vm.1
+M=D
+//@ Output.vm 1728 Output.printChar
+(Output.printChar$IF_FALSE2)
+//@ Output.vm 1729 Output.printChar
+@Output.vm.0
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1730 Output.printChar
+@32
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1731 Output.printChar
+@$OS.ARITHMETIC_IF_57$
+D=A
+@$OS.EQ$
+0;JMP
+($OS.ARITHMETIC_IF_57$)
+//@ Output.vm 1732 Output.printChar
+@SP
+M=M-1
+A=M
+D=M
+@Output.printChar$IF_TRUE3
+D;JNE
+//@ Output.vm 1733 Output.printChar
+@Output.printChar$IF_FALSE3
+0;JMP
+//@ Output.vm 1734 Output.printChar
+(Output.printChar$IF_TRUE3)
+//@ Output.vm 1735 Output.printChar
+@R13
+M=0
+@Output.println
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_145$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_145$)
+//@ Output.vm 1736 Output.printChar
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1737 Output.printChar
+@Output.printChar$IF_END3
+0;JMP
+//@ Output.vm 1738 Output.printChar
+(Output.printChar$IF_FALSE3)
+//@ Output.vm 1739 Output.printChar
+@Output.vm.2
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1740 Output.printChar
+@SP
+D=M-1
+A=D
+M=!M
+//@ Output.vm 1741 Output.printChar
+@SP
+M=M-1
+A=M
+D=M
+@Output.vm.2
+M=D
+//@ Output.vm 1742 Output.printChar
+(Output.printChar$IF_END3)
+//@ Output.vm 1743 Output.printChar
+(Output.printChar$IF_END1)
+//@ Output.vm 1744 Output.printChar
+(Output.printChar$IF_END0)
+//@ Output.vm 1745 Output.printChar
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1746 Output.printChar
+@$OS.RETURN$
+0;JMP
+//@ Output.vm 1747 Output.printString
+(Output.printString)
+D=0
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1748 Output.printString
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1749 Output.printString
+@R13
+M=1
+@String.length
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_146$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_146$)
+//@ Output.vm 1750 Output.printString
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+M=D
+//@ Output.vm 1751 Output.printString
+(Output.printString$WHILE_EXP0)
+//@ Output.vm 1752 Output.printString
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1753 Output.printString
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1754 Output.printString
+@$OS.ARITHMETIC_IF_58$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_58$)
+//@ Output.vm 1755 Output.printString
+@SP
+D=M-1
+A=D
+M=!M
+//@ Output.vm 1756 Output.printString
+@SP
+M=M-1
+A=M
+D=M
+@Output.printString$WHILE_END0
+D;JNE
+//@ Output.vm 1757 Output.printString
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1758 Output.printString
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1759 Output.printString
+@2
+D=A
+@R13
+M=D
+@String.charAt
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_147$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_147$)
+//@ Output.vm 1760 Output.printString
+@R13
+M=1
+@Output.printChar
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_148$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_148$)
+//@ Output.vm 1761 Output.printString
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1762 Output.printString
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1763 Output.printString
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1764 Output.printString
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Output.vm 1765 Output.printString
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Output.vm 1766 Output.printString
+@Output.printString$WHILE_EXP0
+0;JMP
+//@ Output.vm 1767 Output.printString
+(Output.printString$WHILE_END0)
+//@ Output.vm 1768 Output.printString
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1769 Output.printString
+@$OS.RETURN$
+0;JMP
+//@ Output.vm 1770 Output.printInt
+(Output.printInt)
+D=0
+//@ Output.vm 1771 Output.printInt
+@Output.vm.3
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1772 Output.printInt
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1773 Output.printInt
+@2
+D=A
+@R13
+M=D
+@String.setInt
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_149$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_149$)
+//@ Output.vm 1774 Output.printInt
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1775 Output.printInt
+@Output.vm.3
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1776 Output.printInt
+@R13
+M=1
+@Output.printString
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_150$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_150$)
+//@ Output.vm 1777 Output.printInt
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1778 Output.printInt
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1779 Output.printInt
+@$OS.RETURN$
+0;JMP
+//@ Output.vm 1780 Output.println
+(Output.println)
+D=0
+//@ Output.vm 1781 Output.println
+@Output.vm.1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1782 Output.println
+@352
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1783 Output.println
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Output.vm 1784 Output.println
+@Output.vm.0
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1785 Output.println
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Output.vm 1786 Output.println
+@SP
+M=M-1
+A=M
+D=M
+@Output.vm.1
+M=D
+//@ Output.vm 1787 Output.println
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1788 Output.println
+@SP
+M=M-1
+A=M
+D=M
+@Output.vm.0
+M=D
+//@ Output.vm 1789 Output.println
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1790 Output.println
+@SP
+D=M-1
+A=D
+M=!M
+//@ Output.vm 1791 Output.println
+@SP
+M=M-1
+A=M
+D=M
+@Output.vm.2
+M=D
+//@ Output.vm 1792 Output.println
+@Output.vm.1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1793 Output.println
+@8128
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1794 Output.println
+@$OS.ARITHMETIC_IF_59$
+D=A
+@$OS.EQ$
+0;JMP
+($OS.ARITHMETIC_IF_59$)
+//@ Output.vm 1795 Output.println
+@SP
+M=M-1
+A=M
+D=M
+@Output.println$IF_TRUE0
+D;JNE
+//@ Output.vm 1796 Output.println
+@Output.println$IF_FALSE0
+0;JMP
+//@ Output.vm 1797 Output.println
+(Output.println$IF_TRUE0)
+//@ Output.vm 1798 Output.println
+@32
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1799 Output.println
+@SP
+M=M-1
+A=M
+D=M
+@Output.vm.1
+M=D
+//@ Output.vm 1800 Output.println
+(Output.println$IF_FALSE0)
+//@ Output.vm 1801 Output.println
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1802 Output.println
+@$OS.RETURN$
+0;JMP
+//@ Output.vm 1803 Output.backSpace
+(Output.backSpace)
+D=0
+//@ Output.vm 1804 Output.backSpace
+@Output.vm.2
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1805 Output.backSpace
+@SP
+M=M-1
+A=M
+D=M
+@Output.backSpace$IF_TRUE0
+D;JNE
+//@ Output.vm 1806 Output.backSpace
+@Output.backSpace$IF_FALSE0
+0;JMP
+//@ Output.vm 1807 Output.backSpace
+(Output.backSpace$IF_TRUE0)
+//@ Output.vm 1808 Output.backSpace
+@Output.vm.0
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1809 Output.backSpace
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1810 Output.backSpace
+@$OS.ARITHMETIC_IF_60$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_60$)
+//@ Output.vm 1811 Output.backSpace
+@SP
+M=M-1
+A=M
+D=M
+@Output.backSpace$IF_TRUE1
+D;JNE
+//@ Output.vm 1812 Output.backSpace
+@Output.backSpace$IF_FALSE1
+0;JMP
+//@ Output.vm 1813 Output.backSpace
+(Output.backSpace$IF_TRUE1)
+//@ Output.vm 1814 Output.backSpace
+@Output.vm.0
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1815 Output.backSpace
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1816 Output.backSpace
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Output.vm 1817 Output.backSpace
+@SP
+M=M-1
+A=M
+D=M
+@Output.vm.0
+M=D
+//@ Output.vm 1818 Output.backSpace
+@Output.vm.1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1819 Output.backSpace
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1820 Output.backSpace
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Output.vm 1821 Output.backSpace
+@SP
+M=M-1
+A=M
+D=M
+@Output.vm.1
+M=D
+//@ Output.vm 1822 Output.backSpace
+@Output.backSpace$IF_END1
+0;JMP
+//@ Output.vm 1823 Output.backSpace
+(Output.backSpace$IF_FALSE1)
+//@ Output.vm 1824 Output.backSpace
+@31
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1825 Output.backSpace
+@SP
+M=M-1
+A=M
+D=M
+@Output.vm.0
+M=D
+//@ Output.vm 1826 Output.backSpace
+@Output.vm.1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1827 Output.backSpace
+@32
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1828 Output.backSpace
+@$OS.ARITHMETIC_IF_61$
+D=A
+@$OS.EQ$
+0;JMP
+($OS.ARITHMETIC_IF_61$)
+//@ Output.vm 1829 Output.backSpace
+@SP
+M=M-1
+A=M
+D=M
+@Output.backSpace$IF_TRUE2
+D;JNE
+//@ Output.vm 1830 Output.backSpace
+@Output.backSpace$IF_FALSE2
+0;JMP
+//@ Output.vm 1831 Output.backSpace
+(Output.backSpace$IF_TRUE2)
+//@ Output.vm 1832 Output.backSpace
+@8128
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1833 Output.backSpace
+@SP
+M=M-1
+A=M
+D=M
+@Output.vm.1
+M=D
+//@ Output.vm 1834 Output.backSpace
+(Output.backSpace$IF_FALSE2)
+//@ Output.vm 1835 Output.backSpace
+@Output.vm.1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1836 Output.backSpace
+@321
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1837 Output.backSpace
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Output.vm 1838 Output.backSpace
+@SP
+M=M-1
+A=M
+D=M
+@Output.vm.1
+M=D
+//@ Output.vm 1839 Output.backSpace
+(Output.backSpace$IF_END1)
+//@ Output.vm 1840 Output.backSpace
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1841 Output.backSpace
+@SP
+M=M-1
+A=M
+D=M
+@Output.vm.2
+M=D
+//@ Output.vm 1842 Output.backSpace
+@Output.backSpace$IF_END0
+0;JMP
+//@ Output.vm 1843 Output.backSpace
+(Output.backSpace$IF_FALSE0)
+//@ Output.vm 1844 Output.backSpace
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1845 Output.backSpace
+@SP
+D=M-1
+A=D
+M=!M
+//@ Output.vm 1846 Output.backSpace
+@SP
+M=M-1
+A=M
+D=M
+@Output.vm.2
+M=D
+//@ Output.vm 1847 Output.backSpace
+(Output.backSpace$IF_END0)
+//@ Output.vm 1848 Output.backSpace
+@32
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1849 Output.backSpace
+@R13
+M=1
+@Output.drawChar
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_151$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_151$)
+//@ Output.vm 1850 Output.backSpace
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Output.vm 1851 Output.backSpace
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Output.vm 1852 Output.backSpace
+@$OS.RETURN$
+0;JMP
+//@ Screen.vm 1 Screen.init
+(Screen.init)
+D=0
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 2 Screen.init
+@16384
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 3 Screen.init
+@SP
+M=M-1
+A=M
+D=M
+@Screen.vm.1
+M=D
+//@ Screen.vm 4 Screen.init
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 5 Screen.init
+@SP
+D=M-1
+A=D
+M=!M
+//@ Screen.vm 6 Screen.init
+@SP
+M=M-1
+A=M
+D=M
+@Screen.vm.2
+M=D
+//@ Screen.vm 7 Screen.init
+@17
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 8 Screen.init
+@R13
+M=1
+@Array.new
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_152$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_152$)
+//@ Screen.vm 9 Screen.init
+@SP
+M=M-1
+A=M
+D=M
+@Screen.vm.0
+M=D
+//@ Screen.vm 10 Screen.init
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 11 Screen.init
+@Screen.vm.0
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 12 Screen.init
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 13 Screen.init
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 14 Screen.init
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Screen.vm 15 Screen.init
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Screen.vm 16 Screen.init
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 17 Screen.init
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Screen.vm 18 Screen.init
+(Screen.init$WHILE_EXP0)
+//@ Screen.vm 19 Screen.init
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 20 Screen.init
+@16
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 21 Screen.init
+@$OS.ARITHMETIC_IF_62$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_62$)
+//@ Screen.vm 22 Screen.init
+@SP
+D=M-1
+A=D
+M=!M
+//@ Screen.vm 23 Screen.init
+@SP
+M=M-1
+A=M
+D=M
+@Screen.init$WHILE_END0
+D;JNE
+//@ Screen.vm 24 Screen.init
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 25 Screen.init
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 26 Screen.init
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 27 Screen.init
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Screen.vm 28 Screen.init
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 29 Screen.init
+@Screen.vm.0
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 30 Screen.init
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 31 Screen.init
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 32 Screen.init
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 33 Screen.init
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Screen.vm 34 Screen.init
+@Screen.vm.0
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 35 Screen.init
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 36 Screen.init
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Screen.vm 37 Screen.init
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 38 Screen.init
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 39 Screen.init
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 40 Screen.init
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Screen.vm 41 Screen.init
+@Screen.vm.0
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 42 Screen.init
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 43 Screen.init
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Screen.vm 44 Screen.init
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 45 Screen.init
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 46 Screen.init
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Screen.vm 47 Screen.init
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Screen.vm 48 Screen.init
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 49 Screen.init
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Screen.vm 50 Screen.init
+@Screen.init$WHILE_EXP0
+0;JMP
+//@ Screen.vm 51 Screen.init
+(Screen.init$WHILE_END0)
+//@ Screen.vm 52 Screen.init
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 53 Screen.init
+@$OS.RETURN$
+0;JMP
+//@ Screen.vm 54 Screen.clearScreen
+(Screen.clearScreen)
+D=0
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 55 Screen.clearScreen
+(Screen.clearScreen$WHILE_EXP0)
+//@ Screen.vm 56 Screen.clearScreen
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 57 Screen.clearScreen
+@8192
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 58 Screen.clearScreen
+@$OS.ARITHMETIC_IF_63$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_63$)
+//@ Screen.vm 59 Screen.clearScreen
+@SP
+D=M-1
+A=D
+M=!M
+//@ Screen.vm 60 Screen.clearScreen
+@SP
+M=M-1
+A=M
+D=M
+@Screen.clearScreen$WHILE_END0
+D;JNE
+//@ Screen.vm 61 Screen.clearScreen
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 62 Screen.clearScreen
+@Screen.vm.1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 63 Screen.clearScreen
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 64 Screen.clearScreen
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 65 Screen.clearScreen
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Screen.vm 66 Screen.clearScreen
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Screen.vm 67 Screen.clearScreen
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 68 Screen.clearScreen
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Screen.vm 69 Screen.clearScreen
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 70 Screen.clearScreen
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 71 Screen.clearScreen
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 72 Screen.clearScreen
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Screen.vm 73 Screen.clearScreen
+@Screen.clearScreen$WHILE_EXP0
+0;JMP
+//@ Screen.vm 74 Screen.clearScreen
+(Screen.clearScreen$WHILE_END0)
+//@ Screen.vm 75 Screen.clearScreen
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 76 Screen.clearScreen
+@$OS.RETURN$
+0;JMP
+//@ Screen.vm 77 Screen.updateLocation
+(Screen.updateLocation)
+D=0
+//@ Screen.vm 78 Screen.updateLocation
+@Screen.vm.2
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 79 Screen.updateLocation
+@SP
+M=M-1
+A=M
+D=M
+@Screen.updateLocation$IF_TRUE0
+D;JNE
+//@ Screen.vm 80 Screen.updateLocation
+@Screen.updateLocation$IF_FALSE0
+0;JMP
+//@ Screen.vm 81 Screen.updateLocation
+(Screen.updateLocation$IF_TRUE0)
+//@ Screen.vm 82 Screen.updateLocation
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 83 Screen.updateLocation
+@Screen.vm.1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 84 Screen.updateLocation
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 85 Screen.updateLocation
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 86 Screen.updateLocation
+@Screen.vm.1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 87 Screen.updateLocation
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 88 Screen.updateLocation
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Screen.vm 89 Screen.updateLocation
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 90 Screen.updateLocation
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 91 Screen.updateLocation
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ Screen.vm 92 Screen.updateLocation
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Screen.vm 93 Screen.updateLocation
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Screen.vm 94 Screen.updateLocation
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 95 Screen.updateLocation
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Screen.vm 96 Screen.updateLocation
+@Screen.updateLocation$IF_END0
+0;JMP
+//@ Screen.vm 97 Screen.updateLocation
+(Screen.updateLocation$IF_FALSE0)
+//@ Screen.vm 98 Screen.updateLocation
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 99 Screen.updateLocation
+@Screen.vm.1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 100 Screen.updateLocation
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 101 Screen.updateLocation
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 102 Screen.updateLocation
+@Screen.vm.1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 103 Screen.updateLocation
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 104 Screen.updateLocation
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Screen.vm 105 Screen.updateLocation
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 106 Screen.updateLocation
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 107 Screen.updateLocation
+@SP
+D=M-1
+A=D
+M=!M
+//@ Screen.vm 108 Screen.updateLocation
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M&D
+//@ Screen.vm 109 Screen.updateLocation
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Screen.vm 110 Screen.updateLocation
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Screen.vm 111 Screen.updateLocation
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 112 Screen.updateLocation
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ Screen.vm 113 Screen.updateLocation
+(Screen.updateLocation$IF_END0)
+//@ Screen.vm 114 Screen.updateLocation
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 115 Screen.updateLocation
+@$OS.RETURN$
+0;JMP
+//@ Screen.vm 116 Screen.setColor
+(Screen.setColor)
+D=0
+//@ Screen.vm 117 Screen.setColor
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 118 Screen.setColor
+@SP
+M=M-1
+A=M
+D=M
+@Screen.vm.2
+M=D
+//@ Screen.vm 119 Screen.setColor
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 120 Screen.setColor
+@$OS.RETURN$
+0;JMP
+//@ Screen.vm 121 Screen.drawPixel
+(Screen.drawPixel)
+D=0
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 122 Screen.drawPixel
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 123 Screen.drawPixel
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 124 Screen.drawPixel
+@$OS.ARITHMETIC_IF_64$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_64$)
+//@ Screen.vm 125 Screen.drawPixel
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 126 Screen.drawPixel
+@511
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 127 Screen.drawPixel
+@$OS.ARITHMETIC_IF_65$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_65$)
+//@ Screen.vm 128 Screen.drawPixel
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ Screen.vm 129 Screen.drawPixel
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 130 Screen.drawPixel
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 131 Screen.drawPixel
+@$OS.ARITHMETIC_IF_66$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_66$)
+//@ Screen.vm 132 Screen.drawPixel
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ Screen.vm 133 Screen.drawPixel
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 134 Screen.drawPixel
+@255
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 135 Screen.drawPixel
+@$OS.ARITHMETIC_IF_67$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_67$)
+//@ Screen.vm 136 Screen.drawPixel
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ Screen.vm 137 Screen.drawPixel
+@SP
+M=M-1
+A=M
+D=M
+@Screen.drawPixel$IF_TRUE0
+D;JNE
+//@ Screen.vm 138 Screen.drawPixel
+@Screen.drawPixel$IF_FALSE0
+0;JMP
+//@ Screen.vm 139 Screen.drawPixel
+(Screen.drawPixel$IF_TRUE0)
+//@ Screen.vm 140 Screen.drawPixel
+@7
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 141 Screen.drawPixel
+@R13
+M=1
+@Sys.error
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_153$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_153$)
+//@ Screen.vm 142 Screen.drawPixel
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Screen.vm 143 Screen.drawPixel
+(Screen.drawPixel$IF_FALSE0)
+//@ Screen.vm 144 Screen.drawPixel
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 145 Screen.drawPixel
+@16
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 146 Screen.drawPixel
+@2
+D=A
+@R13
+M=D
+@Math.divide
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_154$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_154$)
+//@ Screen.vm 147 Screen.drawPixel
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Screen.vm 148 Screen.drawPixel
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 149 Screen.drawPixel
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 150 Screen.drawPixel
+@16
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 151 Screen.drawPixel
+@2
+D=A
+@R13
+M=D
+@Math.multiply
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_155$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_155$)
+//@ Screen.vm 152 Screen.drawPixel
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Screen.vm 153 Screen.drawPixel
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+M=D
+//@ Screen.vm 154 Screen.drawPixel
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 155 Screen.drawPixel
+@32
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 156 Screen.drawPixel
+@2
+D=A
+@R13
+M=D
+@Math.multiply
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_156$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_156$)
+//@ Screen.vm 157 Screen.drawPixel
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 158 Screen.drawPixel
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 159 Screen.drawPixel
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+M=D
+//@ Screen.vm 160 Screen.drawPixel
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 161 Screen.drawPixel
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 162 Screen.drawPixel
+@Screen.vm.0
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 163 Screen.drawPixel
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 164 Screen.drawPixel
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Screen.vm 165 Screen.drawPixel
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 166 Screen.drawPixel
+@2
+D=A
+@R13
+M=D
+@Screen.updateLocation
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_157$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_157$)
+//@ Screen.vm 167 Screen.drawPixel
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Screen.vm 168 Screen.drawPixel
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 169 Screen.drawPixel
+@$OS.RETURN$
+0;JMP
+//@ Screen.vm 170 Screen.drawConditional
+(Screen.drawConditional)
+D=0
+//@ Screen.vm 171 Screen.drawConditional
+@2
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 172 Screen.drawConditional
+@SP
+M=M-1
+A=M
+D=M
+@Screen.drawConditional$IF_TRUE0
+D;JNE
+//@ Screen.vm 173 Screen.drawConditional
+@Screen.drawConditional$IF_FALSE0
+0;JMP
+//@ Screen.vm 174 Screen.drawConditional
+(Screen.drawConditional$IF_TRUE0)
+//@ Screen.vm 175 Screen.drawConditional
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 176 Screen.drawConditional
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 177 Screen.drawConditional
+@2
+D=A
+@R13
+M=D
+@Screen.drawPixel
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_158$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_158$)
+//@ Screen.vm 178 Screen.drawConditional
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Screen.vm 179 Screen.drawConditional
+@Screen.drawConditional$IF_END0
+0;JMP
+//@ Screen.vm 180 Screen.drawConditional
+(Screen.drawConditional$IF_FALSE0)
+//@ Screen.vm 181 Screen.drawConditional
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 182 Screen.drawConditional
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 183 Screen.drawConditional
+@2
+D=A
+@R13
+M=D
+@Screen.drawPixel
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_159$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_159$)
+//@ Screen.vm 184 Screen.drawConditional
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Screen.vm 185 Screen.drawConditional
+(Screen.drawConditional$IF_END0)
+//@ Screen.vm 186 Screen.drawConditional
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 187 Screen.drawConditional
+@$OS.RETURN$
+0;JMP
+//@ Screen.vm 188 Screen.drawLine
+(Screen.drawLine)
+D=0
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 189 Screen.drawLine
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 190 Screen.drawLine
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 191 Screen.drawLine
+@$OS.ARITHMETIC_IF_68$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_68$)
+//@ Screen.vm 192 Screen.drawLine
+@2
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 193 Screen.drawLine
+@511
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 194 Screen.drawLine
+@$OS.ARITHMETIC_IF_69$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_69$)
+//@ Screen.vm 195 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ Screen.vm 196 Screen.drawLine
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 197 Screen.drawLine
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 198 Screen.drawLine
+@$OS.ARITHMETIC_IF_70$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_70$)
+//@ Screen.vm 199 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ Screen.vm 200 Screen.drawLine
+@3
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 201 Screen.drawLine
+@255
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 202 Screen.drawLine
+@$OS.ARITHMETIC_IF_71$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_71$)
+//@ Screen.vm 203 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ Screen.vm 204 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+@Screen.drawLine$IF_TRUE0
+D;JNE
+//@ Screen.vm 205 Screen.drawLine
+@Screen.drawLine$IF_FALSE0
+0;JMP
+//@ Screen.vm 206 Screen.drawLine
+(Screen.drawLine$IF_TRUE0)
+//@ Screen.vm 207 Screen.drawLine
+@8
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 208 Screen.drawLine
+@R13
+M=1
+@Sys.error
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_160$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_160$)
+//@ Screen.vm 209 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Screen.vm 210 Screen.drawLine
+(Screen.drawLine$IF_FALSE0)
+//@ Screen.vm 211 Screen.drawLine
+@2
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 212 Screen.drawLine
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 213 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Screen.vm 214 Screen.drawLine
+@R13
+M=1
+@Math.abs
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_161$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_161$)
+//@ Screen.vm 215 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+A=A+1
+M=D
+//@ Screen.vm 216 Screen.drawLine
+@3
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 217 Screen.drawLine
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 218 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Screen.vm 219 Screen.drawLine
+@R13
+M=1
+@Math.abs
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_162$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_162$)
+//@ Screen.vm 220 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+M=D
+//@ Screen.vm 221 Screen.drawLine
+@3
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 222 Screen.drawLine
+@2
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 223 Screen.drawLine
+@$OS.ARITHMETIC_IF_72$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_72$)
+//@ Screen.vm 224 Screen.drawLine
+@6
+D=A
+@LCL
+D=M+D
+@R13
+M=D
+@SP
+M=M-1
+A=M
+D=M
+@R13
+A=M
+M=D
+//@ Screen.vm 225 Screen.drawLine
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 226 Screen.drawLine
+@3
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 227 Screen.drawLine
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 228 Screen.drawLine
+@$OS.ARITHMETIC_IF_73$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_73$)
+//@ Screen.vm 229 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M&D
+//@ Screen.vm 230 Screen.drawLine
+@6
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 231 Screen.drawLine
+@SP
+D=M-1
+A=D
+M=!M
+//@ Screen.vm 232 Screen.drawLine
+@2
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 233 Screen.drawLine
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 234 Screen.drawLine
+@$OS.ARITHMETIC_IF_74$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_74$)
+//@ Screen.vm 235 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M&D
+//@ Screen.vm 236 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ Screen.vm 237 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+@Screen.drawLine$IF_TRUE1
+D;JNE
+//@ Screen.vm 238 Screen.drawLine
+@Screen.drawLine$IF_FALSE1
+0;JMP
+//@ Screen.vm 239 Screen.drawLine
+(Screen.drawLine$IF_TRUE1)
+//@ Screen.vm 240 Screen.drawLine
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 241 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+A=A+1
+A=A+1
+M=D
+//@ Screen.vm 242 Screen.drawLine
+@2
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 243 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+@ARG
+A=M
+M=D
+//@ Screen.vm 244 Screen.drawLine
+@4
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 245 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+@ARG
+A=M
+A=A+1
+A=A+1
+M=D
+//@ Screen.vm 246 Screen.drawLine
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 247 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+A=A+1
+A=A+1
+M=D
+//@ Screen.vm 248 Screen.drawLine
+@3
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 249 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+@ARG
+A=M
+A=A+1
+M=D
+//@ Screen.vm 250 Screen.drawLine
+@4
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 251 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+@ARG
+A=M
+A=A+1
+A=A+1
+A=A+1
+M=D
+//@ Screen.vm 252 Screen.drawLine
+(Screen.drawLine$IF_FALSE1)
+//@ Screen.vm 253 Screen.drawLine
+@6
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 254 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+@Screen.drawLine$IF_TRUE2
+D;JNE
+//@ Screen.vm 255 Screen.drawLine
+@Screen.drawLine$IF_FALSE2
+0;JMP
+//@ Screen.vm 256 Screen.drawLine
+(Screen.drawLine$IF_TRUE2)
+//@ Screen.vm 257 Screen.drawLine
+@3
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 258 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+A=A+1
+A=A+1
+M=D
+//@ Screen.vm 259 Screen.drawLine
+@2
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 260 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+A=A+1
+M=D
+//@ Screen.vm 261 Screen.drawLine
+@4
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 262 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+M=D
+//@ Screen.vm 263 Screen.drawLine
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 264 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+M=D
+//@ Screen.vm 265 Screen.drawLine
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 266 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Screen.vm 267 Screen.drawLine
+@3
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 268 Screen.drawLine
+@8
+D=A
+@LCL
+D=M+D
+@R13
+M=D
+@SP
+M=M-1
+A=M
+D=M
+@R13
+A=M
+M=D
+//@ Screen.vm 269 Screen.drawLine
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 270 Screen.drawLine
+@2
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 271 Screen.drawLine
+@$OS.ARITHMETIC_IF_75$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_75$)
+//@ Screen.vm 272 Screen.drawLine
+@7
+D=A
+@LCL
+D=M+D
+@R13
+M=D
+@SP
+M=M-1
+A=M
+D=M
+@R13
+A=M
+M=D
+//@ Screen.vm 273 Screen.drawLine
+@Screen.drawLine$IF_END2
+0;JMP
+//@ Screen.vm 274 Screen.drawLine
+(Screen.drawLine$IF_FALSE2)
+//@ Screen.vm 275 Screen.drawLine
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 276 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+M=D
+//@ Screen.vm 277 Screen.drawLine
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 278 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Screen.vm 279 Screen.drawLine
+@2
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 280 Screen.drawLine
+@8
+D=A
+@LCL
+D=M+D
+@R13
+M=D
+@SP
+M=M-1
+A=M
+D=M
+@R13
+A=M
+M=D
+//@ Screen.vm 281 Screen.drawLine
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 282 Screen.drawLine
+@3
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 283 Screen.drawLine
+@$OS.ARITHMETIC_IF_76$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_76$)
+//@ Screen.vm 284 Screen.drawLine
+@7
+D=A
+@LCL
+D=M+D
+@R13
+M=D
+@SP
+M=M-1
+A=M
+D=M
+@R13
+A=M
+M=D
+//@ Screen.vm 285 Screen.drawLine
+(Screen.drawLine$IF_END2)
+//@ Screen.vm 286 Screen.drawLine
+@2
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 287 Screen.drawLine
+@2
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 288 Screen.drawLine
+@2
+D=A
+@R13
+M=D
+@Math.multiply
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_163$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_163$)
+//@ Screen.vm 289 Screen.drawLine
+@3
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 290 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Screen.vm 291 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+A=A+1
+A=A+1
+A=A+1
+M=D
+//@ Screen.vm 292 Screen.drawLine
+@2
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 293 Screen.drawLine
+@2
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 294 Screen.drawLine
+@2
+D=A
+@R13
+M=D
+@Math.multiply
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_164$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_164$)
+//@ Screen.vm 295 Screen.drawLine
+@9
+D=A
+@LCL
+D=M+D
+@R13
+M=D
+@SP
+M=M-1
+A=M
+D=M
+@R13
+A=M
+M=D
+//@ Screen.vm 296 Screen.drawLine
+@2
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 297 Screen.drawLine
+@2
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 298 Screen.drawLine
+@3
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 299 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Screen.vm 300 Screen.drawLine
+@2
+D=A
+@R13
+M=D
+@Math.multiply
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_165$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_165$)
+//@ Screen.vm 301 Screen.drawLine
+@10
+D=A
+@LCL
+D=M+D
+@R13
+M=D
+@SP
+M=M-1
+A=M
+D=M
+@R13
+A=M
+M=D
+//@ Screen.vm 302 Screen.drawLine
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 303 Screen.drawLine
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 304 Screen.drawLine
+@6
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 305 Screen.drawLine
+@3
+D=A
+@R13
+M=D
+@Screen.drawConditional
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_166$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_166$)
+//@ Screen.vm 306 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Screen.vm 307 Screen.drawLine
+(Screen.drawLine$WHILE_EXP0)
+//@ Screen.vm 308 Screen.drawLine
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 309 Screen.drawLine
+@8
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 310 Screen.drawLine
+@$OS.ARITHMETIC_IF_77$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_77$)
+//@ Screen.vm 311 Screen.drawLine
+@SP
+D=M-1
+A=D
+M=!M
+//@ Screen.vm 312 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+@Screen.drawLine$WHILE_END0
+D;JNE
+//@ Screen.vm 313 Screen.drawLine
+@5
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 314 Screen.drawLine
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 315 Screen.drawLine
+@$OS.ARITHMETIC_IF_78$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_78$)
+//@ Screen.vm 316 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+@Screen.drawLine$IF_TRUE3
+D;JNE
+//@ Screen.vm 317 Screen.drawLine
+@Screen.drawLine$IF_FALSE3
+0;JMP
+//@ Screen.vm 318 Screen.drawLine
+(Screen.drawLine$IF_TRUE3)
+//@ Screen.vm 319 Screen.drawLine
+@5
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 320 Screen.drawLine
+@9
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 321 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 322 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+A=A+1
+A=A+1
+A=A+1
+M=D
+//@ Screen.vm 323 Screen.drawLine
+@Screen.drawLine$IF_END3
+0;JMP
+//@ Screen.vm 324 Screen.drawLine
+(Screen.drawLine$IF_FALSE3)
+//@ Screen.vm 325 Screen.drawLine
+@5
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 326 Screen.drawLine
+@10
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 327 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 328 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+A=A+1
+A=A+1
+A=A+1
+M=D
+//@ Screen.vm 329 Screen.drawLine
+@7
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 330 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+@Screen.drawLine$IF_TRUE4
+D;JNE
+//@ Screen.vm 331 Screen.drawLine
+@Screen.drawLine$IF_FALSE4
+0;JMP
+//@ Screen.vm 332 Screen.drawLine
+(Screen.drawLine$IF_TRUE4)
+//@ Screen.vm 333 Screen.drawLine
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 334 Screen.drawLine
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 335 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Screen.vm 336 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Screen.vm 337 Screen.drawLine
+@Screen.drawLine$IF_END4
+0;JMP
+//@ Screen.vm 338 Screen.drawLine
+(Screen.drawLine$IF_FALSE4)
+//@ Screen.vm 339 Screen.drawLine
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 340 Screen.drawLine
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 341 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 342 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Screen.vm 343 Screen.drawLine
+(Screen.drawLine$IF_END4)
+//@ Screen.vm 344 Screen.drawLine
+(Screen.drawLine$IF_END3)
+//@ Screen.vm 345 Screen.drawLine
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 346 Screen.drawLine
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 347 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 348 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+M=D
+//@ Screen.vm 349 Screen.drawLine
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 350 Screen.drawLine
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 351 Screen.drawLine
+@6
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 352 Screen.drawLine
+@3
+D=A
+@R13
+M=D
+@Screen.drawConditional
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_167$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_167$)
+//@ Screen.vm 353 Screen.drawLine
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Screen.vm 354 Screen.drawLine
+@Screen.drawLine$WHILE_EXP0
+0;JMP
+//@ Screen.vm 355 Screen.drawLine
+(Screen.drawLine$WHILE_END0)
+//@ Screen.vm 356 Screen.drawLine
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 357 Screen.drawLine
+@$OS.RETURN$
+0;JMP
+//@ Screen.vm 358 Screen.drawRectangle
+(Screen.drawRectangle)
+D=0
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 359 Screen.drawRectangle
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 360 Screen.drawRectangle
+@2
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 361 Screen.drawRectangle
+@$OS.ARITHMETIC_IF_79$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_79$)
+//@ Screen.vm 362 Screen.drawRectangle
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 363 Screen.drawRectangle
+@3
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 364 Screen.drawRectangle
+@$OS.ARITHMETIC_IF_80$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_80$)
+//@ Screen.vm 365 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ Screen.vm 366 Screen.drawRectangle
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 367 Screen.drawRectangle
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 368 Screen.drawRectangle
+@$OS.ARITHMETIC_IF_81$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_81$)
+//@ Screen.vm 369 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ Screen.vm 370 Screen.drawRectangle
+@2
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 371 Screen.drawRectangle
+@511
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 372 Screen.drawRectangle
+@$OS.ARITHMETIC_IF_82$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_82$)
+//@ Screen.vm 373 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ Screen.vm 374 Screen.drawRectangle
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 375 Screen.drawRectangle
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 376 Screen.drawRectangle
+@$OS.ARITHMETIC_IF_83$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_83$)
+//@ Screen.vm 377 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ Screen.vm 378 Screen.drawRectangle
+@3
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 379 Screen.drawRectangle
+@255
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 380 Screen.drawRectangle
+@$OS.ARITHMETIC_IF_84$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_84$)
+//@ Screen.vm 381 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ Screen.vm 382 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+@Screen.drawRectangle$IF_TRUE0
+D;JNE
+//@ Screen.vm 383 Screen.drawRectangle
+@Screen.drawRectangle$IF_FALSE0
+0;JMP
+//@ Screen.vm 384 Screen.drawRectangle
+(Screen.drawRectangle$IF_TRUE0)
+//@ Screen.vm 385 Screen.drawRectangle
+@9
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 386 Screen.drawRectangle
+@R13
+M=1
+@Sys.error
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_168$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_168$)
+//@ Screen.vm 387 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Screen.vm 388 Screen.drawRectangle
+(Screen.drawRectangle$IF_FALSE0)
+//@ Screen.vm 389 Screen.drawRectangle
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 390 Screen.drawRectangle
+@16
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 391 Screen.drawRectangle
+@2
+D=A
+@R13
+M=D
+@Math.divide
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_169$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_169$)
+//@ Screen.vm 392 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+A=A+1
+M=D
+//@ Screen.vm 393 Screen.drawRectangle
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 394 Screen.drawRectangle
+@3
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 395 Screen.drawRectangle
+@16
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 396 Screen.drawRectangle
+@2
+D=A
+@R13
+M=D
+@Math.multiply
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_170$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_170$)
+//@ Screen.vm 397 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Screen.vm 398 Screen.drawRectangle
+@7
+D=A
+@LCL
+D=M+D
+@R13
+M=D
+@SP
+M=M-1
+A=M
+D=M
+@R13
+A=M
+M=D
+//@ Screen.vm 399 Screen.drawRectangle
+@2
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 400 Screen.drawRectangle
+@16
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 401 Screen.drawRectangle
+@2
+D=A
+@R13
+M=D
+@Math.divide
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_171$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_171$)
+//@ Screen.vm 402 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+A=A+1
+A=A+1
+M=D
+//@ Screen.vm 403 Screen.drawRectangle
+@2
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 404 Screen.drawRectangle
+@4
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 405 Screen.drawRectangle
+@16
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 406 Screen.drawRectangle
+@2
+D=A
+@R13
+M=D
+@Math.multiply
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_172$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_172$)
+//@ Screen.vm 407 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Screen.vm 408 Screen.drawRectangle
+@8
+D=A
+@LCL
+D=M+D
+@R13
+M=D
+@SP
+M=M-1
+A=M
+D=M
+@R13
+A=M
+M=D
+//@ Screen.vm 409 Screen.drawRectangle
+@7
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 410 Screen.drawRectangle
+@Screen.vm.0
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 411 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 412 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Screen.vm 413 Screen.drawRectangle
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 414 Screen.drawRectangle
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 415 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Screen.vm 416 Screen.drawRectangle
+@SP
+D=M-1
+A=D
+M=!M
+//@ Screen.vm 417 Screen.drawRectangle
+@6
+D=A
+@LCL
+D=M+D
+@R13
+M=D
+@SP
+M=M-1
+A=M
+D=M
+@R13
+A=M
+M=D
+//@ Screen.vm 418 Screen.drawRectangle
+@8
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 419 Screen.drawRectangle
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 420 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 421 Screen.drawRectangle
+@Screen.vm.0
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 422 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 423 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Screen.vm 424 Screen.drawRectangle
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 425 Screen.drawRectangle
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 426 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Screen.vm 427 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+A=A+1
+A=A+1
+A=A+1
+M=D
+//@ Screen.vm 428 Screen.drawRectangle
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 429 Screen.drawRectangle
+@32
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 430 Screen.drawRectangle
+@2
+D=A
+@R13
+M=D
+@Math.multiply
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_173$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_173$)
+//@ Screen.vm 431 Screen.drawRectangle
+@3
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 432 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 433 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Screen.vm 434 Screen.drawRectangle
+@4
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 435 Screen.drawRectangle
+@3
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 436 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Screen.vm 437 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+M=D
+//@ Screen.vm 438 Screen.drawRectangle
+(Screen.drawRectangle$WHILE_EXP0)
+//@ Screen.vm 439 Screen.drawRectangle
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 440 Screen.drawRectangle
+@3
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 441 Screen.drawRectangle
+@$OS.ARITHMETIC_IF_85$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_85$)
+//@ Screen.vm 442 Screen.drawRectangle
+@SP
+D=M-1
+A=D
+M=!M
+//@ Screen.vm 443 Screen.drawRectangle
+@SP
+D=M-1
+A=D
+M=!M
+//@ Screen.vm 444 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+@Screen.drawRectangle$WHILE_END0
+D;JNE
+//@ Screen.vm 445 Screen.drawRectangle
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 446 Screen.drawRectangle
+@2
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 447 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 448 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+M=D
+//@ Screen.vm 449 Screen.drawRectangle
+@2
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 450 Screen.drawRectangle
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 451 Screen.drawRectangle
+@$OS.ARITHMETIC_IF_86$
+D=A
+@$OS.EQ$
+0;JMP
+($OS.ARITHMETIC_IF_86$)
+//@ Screen.vm 452 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+@Screen.drawRectangle$IF_TRUE1
+D;JNE
+//@ Screen.vm 453 Screen.drawRectangle
+@Screen.drawRectangle$IF_FALSE1
+0;JMP
+//@ Screen.vm 454 Screen.drawRectangle
+(Screen.drawRectangle$IF_TRUE1)
+//@ Screen.vm 455 Screen.drawRectangle
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 456 Screen.drawRectangle
+@5
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 457 Screen.drawRectangle
+@6
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 458 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M&D
+//@ Screen.vm 459 Screen.drawRectangle
+@2
+D=A
+@R13
+M=D
+@Screen.updateLocation
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_174$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_174$)
+//@ Screen.vm 460 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Screen.vm 461 Screen.drawRectangle
+@Screen.drawRectangle$IF_END1
+0;JMP
+//@ Screen.vm 462 Screen.drawRectangle
+(Screen.drawRectangle$IF_FALSE1)
+//@ Screen.vm 463 Screen.drawRectangle
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 464 Screen.drawRectangle
+@6
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 465 Screen.drawRectangle
+@2
+D=A
+@R13
+M=D
+@Screen.updateLocation
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_175$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_175$)
+//@ Screen.vm 466 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Screen.vm 467 Screen.drawRectangle
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 468 Screen.drawRectangle
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 469 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 470 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Screen.vm 471 Screen.drawRectangle
+(Screen.drawRectangle$WHILE_EXP1)
+//@ Screen.vm 472 Screen.drawRectangle
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 473 Screen.drawRectangle
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 474 Screen.drawRectangle
+@$OS.ARITHMETIC_IF_87$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_87$)
+//@ Screen.vm 475 Screen.drawRectangle
+@SP
+D=M-1
+A=D
+M=!M
+//@ Screen.vm 476 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+@Screen.drawRectangle$WHILE_END1
+D;JNE
+//@ Screen.vm 477 Screen.drawRectangle
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 478 Screen.drawRectangle
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 479 Screen.drawRectangle
+@SP
+D=M-1
+A=D
+M=-M
+//@ Screen.vm 480 Screen.drawRectangle
+@2
+D=A
+@R13
+M=D
+@Screen.updateLocation
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_176$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_176$)
+//@ Screen.vm 481 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Screen.vm 482 Screen.drawRectangle
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 483 Screen.drawRectangle
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 484 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 485 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Screen.vm 486 Screen.drawRectangle
+@Screen.drawRectangle$WHILE_EXP1
+0;JMP
+//@ Screen.vm 487 Screen.drawRectangle
+(Screen.drawRectangle$WHILE_END1)
+//@ Screen.vm 488 Screen.drawRectangle
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 489 Screen.drawRectangle
+@5
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 490 Screen.drawRectangle
+@2
+D=A
+@R13
+M=D
+@Screen.updateLocation
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_177$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_177$)
+//@ Screen.vm 491 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Screen.vm 492 Screen.drawRectangle
+(Screen.drawRectangle$IF_END1)
+//@ Screen.vm 493 Screen.drawRectangle
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 494 Screen.drawRectangle
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 495 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 496 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+@ARG
+A=M
+A=A+1
+M=D
+//@ Screen.vm 497 Screen.drawRectangle
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 498 Screen.drawRectangle
+@32
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 499 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 500 Screen.drawRectangle
+@2
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 501 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Screen.vm 502 Screen.drawRectangle
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Screen.vm 503 Screen.drawRectangle
+@Screen.drawRectangle$WHILE_EXP0
+0;JMP
+//@ Screen.vm 504 Screen.drawRectangle
+(Screen.drawRectangle$WHILE_END0)
+//@ Screen.vm 505 Screen.drawRectangle
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 506 Screen.drawRectangle
+@$OS.RETURN$
+0;JMP
+//@ Screen.vm 507 Screen.drawHorizontal
+(Screen.drawHorizontal)
+D=0
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 508 Screen.drawHorizontal
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 509 Screen.drawHorizontal
+@2
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 510 Screen.drawHorizontal
+@2
+D=A
+@R13
+M=D
+@Math.min
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_178$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_178$)
+//@ Screen.vm 511 Screen.drawHorizontal
+@7
+D=A
+@LCL
+D=M+D
+@R13
+M=D
+@SP
+M=M-1
+A=M
+D=M
+@R13
+A=M
+M=D
+//@ Screen.vm 512 Screen.drawHorizontal
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 513 Screen.drawHorizontal
+@2
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 514 Screen.drawHorizontal
+@2
+D=A
+@R13
+M=D
+@Math.max
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_179$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_179$)
+//@ Screen.vm 515 Screen.drawHorizontal
+@8
+D=A
+@LCL
+D=M+D
+@R13
+M=D
+@SP
+M=M-1
+A=M
+D=M
+@R13
+A=M
+M=D
+//@ Screen.vm 516 Screen.drawHorizontal
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 517 Screen.drawHorizontal
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 518 Screen.drawHorizontal
+@SP
+D=M-1
+A=D
+M=-M
+//@ Screen.vm 519 Screen.drawHorizontal
+@$OS.ARITHMETIC_IF_88$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_88$)
+//@ Screen.vm 520 Screen.drawHorizontal
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 521 Screen.drawHorizontal
+@256
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 522 Screen.drawHorizontal
+@$OS.ARITHMETIC_IF_89$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_89$)
+//@ Screen.vm 523 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M&D
+//@ Screen.vm 524 Screen.drawHorizontal
+@7
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 525 Screen.drawHorizontal
+@512
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 526 Screen.drawHorizontal
+@$OS.ARITHMETIC_IF_90$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_90$)
+//@ Screen.vm 527 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M&D
+//@ Screen.vm 528 Screen.drawHorizontal
+@8
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 529 Screen.drawHorizontal
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 530 Screen.drawHorizontal
+@SP
+D=M-1
+A=D
+M=-M
+//@ Screen.vm 531 Screen.drawHorizontal
+@$OS.ARITHMETIC_IF_91$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_91$)
+//@ Screen.vm 532 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M&D
+//@ Screen.vm 533 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+@Screen.drawHorizontal$IF_TRUE0
+D;JNE
+//@ Screen.vm 534 Screen.drawHorizontal
+@Screen.drawHorizontal$IF_FALSE0
+0;JMP
+//@ Screen.vm 535 Screen.drawHorizontal
+(Screen.drawHorizontal$IF_TRUE0)
+//@ Screen.vm 536 Screen.drawHorizontal
+@7
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 537 Screen.drawHorizontal
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 538 Screen.drawHorizontal
+@2
+D=A
+@R13
+M=D
+@Math.max
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_180$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_180$)
+//@ Screen.vm 539 Screen.drawHorizontal
+@7
+D=A
+@LCL
+D=M+D
+@R13
+M=D
+@SP
+M=M-1
+A=M
+D=M
+@R13
+A=M
+M=D
+//@ Screen.vm 540 Screen.drawHorizontal
+@8
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 541 Screen.drawHorizontal
+@511
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 542 Screen.drawHorizontal
+@2
+D=A
+@R13
+M=D
+@Math.min
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_181$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_181$)
+//@ Screen.vm 543 Screen.drawHorizontal
+@8
+D=A
+@LCL
+D=M+D
+@R13
+M=D
+@SP
+M=M-1
+A=M
+D=M
+@R13
+A=M
+M=D
+//@ Screen.vm 544 Screen.drawHorizontal
+@7
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 545 Screen.drawHorizontal
+@16
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 546 Screen.drawHorizontal
+@2
+D=A
+@R13
+M=D
+@Math.divide
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_182$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_182$)
+//@ Screen.vm 547 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+M=D
+//@ Screen.vm 548 Screen.drawHorizontal
+@7
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 549 Screen.drawHorizontal
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 550 Screen.drawHorizontal
+@16
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 551 Screen.drawHorizontal
+@2
+D=A
+@R13
+M=D
+@Math.multiply
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_183$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_183$)
+//@ Screen.vm 552 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Screen.vm 553 Screen.drawHorizontal
+@9
+D=A
+@LCL
+D=M+D
+@R13
+M=D
+@SP
+M=M-1
+A=M
+D=M
+@R13
+A=M
+M=D
+//@ Screen.vm 554 Screen.drawHorizontal
+@8
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 555 Screen.drawHorizontal
+@16
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 556 Screen.drawHorizontal
+@2
+D=A
+@R13
+M=D
+@Math.divide
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_184$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_184$)
+//@ Screen.vm 557 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+M=D
+//@ Screen.vm 558 Screen.drawHorizontal
+@8
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 559 Screen.drawHorizontal
+@2
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 560 Screen.drawHorizontal
+@16
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 561 Screen.drawHorizontal
+@2
+D=A
+@R13
+M=D
+@Math.multiply
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_185$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_185$)
+//@ Screen.vm 562 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Screen.vm 563 Screen.drawHorizontal
+@10
+D=A
+@LCL
+D=M+D
+@R13
+M=D
+@SP
+M=M-1
+A=M
+D=M
+@R13
+A=M
+M=D
+//@ Screen.vm 564 Screen.drawHorizontal
+@9
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 565 Screen.drawHorizontal
+@Screen.vm.0
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 566 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 567 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Screen.vm 568 Screen.drawHorizontal
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 569 Screen.drawHorizontal
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 570 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Screen.vm 571 Screen.drawHorizontal
+@SP
+D=M-1
+A=D
+M=!M
+//@ Screen.vm 572 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+A=A+1
+A=A+1
+A=A+1
+M=D
+//@ Screen.vm 573 Screen.drawHorizontal
+@10
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 574 Screen.drawHorizontal
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 575 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 576 Screen.drawHorizontal
+@Screen.vm.0
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 577 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 578 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ Screen.vm 579 Screen.drawHorizontal
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 580 Screen.drawHorizontal
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 581 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Screen.vm 582 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+A=A+1
+A=A+1
+M=D
+//@ Screen.vm 583 Screen.drawHorizontal
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 584 Screen.drawHorizontal
+@32
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 585 Screen.drawHorizontal
+@2
+D=A
+@R13
+M=D
+@Math.multiply
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_186$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_186$)
+//@ Screen.vm 586 Screen.drawHorizontal
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 587 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 588 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Screen.vm 589 Screen.drawHorizontal
+@2
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 590 Screen.drawHorizontal
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 591 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Screen.vm 592 Screen.drawHorizontal
+@6
+D=A
+@LCL
+D=M+D
+@R13
+M=D
+@SP
+M=M-1
+A=M
+D=M
+@R13
+A=M
+M=D
+//@ Screen.vm 593 Screen.drawHorizontal
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 594 Screen.drawHorizontal
+@6
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 595 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 596 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+A=A+1
+M=D
+//@ Screen.vm 597 Screen.drawHorizontal
+@6
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 598 Screen.drawHorizontal
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 599 Screen.drawHorizontal
+@$OS.ARITHMETIC_IF_92$
+D=A
+@$OS.EQ$
+0;JMP
+($OS.ARITHMETIC_IF_92$)
+//@ Screen.vm 600 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+@Screen.drawHorizontal$IF_TRUE1
+D;JNE
+//@ Screen.vm 601 Screen.drawHorizontal
+@Screen.drawHorizontal$IF_FALSE1
+0;JMP
+//@ Screen.vm 602 Screen.drawHorizontal
+(Screen.drawHorizontal$IF_TRUE1)
+//@ Screen.vm 603 Screen.drawHorizontal
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 604 Screen.drawHorizontal
+@4
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 605 Screen.drawHorizontal
+@5
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 606 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M&D
+//@ Screen.vm 607 Screen.drawHorizontal
+@2
+D=A
+@R13
+M=D
+@Screen.updateLocation
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_187$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_187$)
+//@ Screen.vm 608 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Screen.vm 609 Screen.drawHorizontal
+@Screen.drawHorizontal$IF_END1
+0;JMP
+//@ Screen.vm 610 Screen.drawHorizontal
+(Screen.drawHorizontal$IF_FALSE1)
+//@ Screen.vm 611 Screen.drawHorizontal
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 612 Screen.drawHorizontal
+@5
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 613 Screen.drawHorizontal
+@2
+D=A
+@R13
+M=D
+@Screen.updateLocation
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_188$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_188$)
+//@ Screen.vm 614 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Screen.vm 615 Screen.drawHorizontal
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 616 Screen.drawHorizontal
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 617 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 618 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Screen.vm 619 Screen.drawHorizontal
+(Screen.drawHorizontal$WHILE_EXP0)
+//@ Screen.vm 620 Screen.drawHorizontal
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 621 Screen.drawHorizontal
+@3
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 622 Screen.drawHorizontal
+@$OS.ARITHMETIC_IF_93$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_93$)
+//@ Screen.vm 623 Screen.drawHorizontal
+@SP
+D=M-1
+A=D
+M=!M
+//@ Screen.vm 624 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+@Screen.drawHorizontal$WHILE_END0
+D;JNE
+//@ Screen.vm 625 Screen.drawHorizontal
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 626 Screen.drawHorizontal
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 627 Screen.drawHorizontal
+@SP
+D=M-1
+A=D
+M=-M
+//@ Screen.vm 628 Screen.drawHorizontal
+@2
+D=A
+@R13
+M=D
+@Screen.updateLocation
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_189$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_189$)
+//@ Screen.vm 629 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Screen.vm 630 Screen.drawHorizontal
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 631 Screen.drawHorizontal
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 632 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 633 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Screen.vm 634 Screen.drawHorizontal
+@Screen.drawHorizontal$WHILE_EXP0
+0;JMP
+//@ Screen.vm 635 Screen.drawHorizontal
+(Screen.drawHorizontal$WHILE_END0)
+//@ Screen.vm 636 Screen.drawHorizontal
+@3
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 637 Screen.drawHorizontal
+@4
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 638 Screen.drawHorizontal
+@2
+D=A
+@R13
+M=D
+@Screen.updateLocation
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_190$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_190$)
+//@ Screen.vm 639 Screen.drawHorizontal
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Screen.vm 640 Screen.drawHorizontal
+(Screen.drawHorizontal$IF_END1)
+//@ Screen.vm 641 Screen.drawHorizontal
+(Screen.drawHorizontal$IF_FALSE0)
+//@ Screen.vm 642 Screen.drawHorizontal
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 643 Screen.drawHorizontal
+@$OS.RETURN$
+0;JMP
+//@ Screen.vm 644 Screen.drawSymetric
+(Screen.drawSymetric)
+D=0
+//@ Screen.vm 645 Screen.drawSymetric
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 646 Screen.drawSymetric
+@3
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 647 Screen.drawSymetric
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Screen.vm 648 Screen.drawSymetric
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 649 Screen.drawSymetric
+@2
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 650 Screen.drawSymetric
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 651 Screen.drawSymetric
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 652 Screen.drawSymetric
+@2
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 653 Screen.drawSymetric
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Screen.vm 654 Screen.drawSymetric
+@3
+D=A
+@R13
+M=D
+@Screen.drawHorizontal
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_191$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_191$)
+//@ Screen.vm 655 Screen.drawSymetric
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Screen.vm 656 Screen.drawSymetric
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 657 Screen.drawSymetric
+@3
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 658 Screen.drawSymetric
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 659 Screen.drawSymetric
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 660 Screen.drawSymetric
+@2
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 661 Screen.drawSymetric
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 662 Screen.drawSymetric
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 663 Screen.drawSymetric
+@2
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 664 Screen.drawSymetric
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Screen.vm 665 Screen.drawSymetric
+@3
+D=A
+@R13
+M=D
+@Screen.drawHorizontal
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_192$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_192$)
+//@ Screen.vm 666 Screen.drawSymetric
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Screen.vm 667 Screen.drawSymetric
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 668 Screen.drawSymetric
+@2
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 669 Screen.drawSymetric
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Screen.vm 670 Screen.drawSymetric
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 671 Screen.drawSymetric
+@3
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 672 Screen.drawSymetric
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Screen.vm 673 Screen.drawSymetric
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 674 Screen.drawSymetric
+@3
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 675 Screen.drawSymetric
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 676 Screen.drawSymetric
+@3
+D=A
+@R13
+M=D
+@Screen.drawHorizontal
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_193$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_193$)
+//@ Screen.vm 677 Screen.drawSymetric
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Screen.vm 678 Screen.drawSymetric
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 679 Screen.drawSymetric
+@2
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 680 Screen.drawSymetric
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 681 Screen.drawSymetric
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 682 Screen.drawSymetric
+@3
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 683 Screen.drawSymetric
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Screen.vm 684 Screen.drawSymetric
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 685 Screen.drawSymetric
+@3
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 686 Screen.drawSymetric
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 687 Screen.drawSymetric
+@3
+D=A
+@R13
+M=D
+@Screen.drawHorizontal
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_194$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_194$)
+//@ Screen.vm 688 Screen.drawSymetric
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Screen.vm 689 Screen.drawSymetric
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 690 Screen.drawSymetric
+@$OS.RETURN$
+0;JMP
+//@ Screen.vm 691 Screen.drawCircle
+(Screen.drawCircle)
+D=0
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 692 Screen.drawCircle
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 693 Screen.drawCircle
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 694 Screen.drawCircle
+@$OS.ARITHMETIC_IF_94$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_94$)
+//@ Screen.vm 695 Screen.drawCircle
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 696 Screen.drawCircle
+@511
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 697 Screen.drawCircle
+@$OS.ARITHMETIC_IF_95$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_95$)
+//@ Screen.vm 698 Screen.drawCircle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ Screen.vm 699 Screen.drawCircle
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 700 Screen.drawCircle
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 701 Screen.drawCircle
+@$OS.ARITHMETIC_IF_96$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_96$)
+//@ Screen.vm 702 Screen.drawCircle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ Screen.vm 703 Screen.drawCircle
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 704 Screen.drawCircle
+@255
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 705 Screen.drawCircle
+@$OS.ARITHMETIC_IF_97$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_97$)
+//@ Screen.vm 706 Screen.drawCircle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ Screen.vm 707 Screen.drawCircle
+@SP
+M=M-1
+A=M
+D=M
+@Screen.drawCircle$IF_TRUE0
+D;JNE
+//@ Screen.vm 708 Screen.drawCircle
+@Screen.drawCircle$IF_FALSE0
+0;JMP
+//@ Screen.vm 709 Screen.drawCircle
+(Screen.drawCircle$IF_TRUE0)
+//@ Screen.vm 710 Screen.drawCircle
+@12
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 711 Screen.drawCircle
+@R13
+M=1
+@Sys.error
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_195$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_195$)
+//@ Screen.vm 712 Screen.drawCircle
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Screen.vm 713 Screen.drawCircle
+(Screen.drawCircle$IF_FALSE0)
+//@ Screen.vm 714 Screen.drawCircle
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 715 Screen.drawCircle
+@2
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 716 Screen.drawCircle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Screen.vm 717 Screen.drawCircle
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 718 Screen.drawCircle
+@$OS.ARITHMETIC_IF_98$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_98$)
+//@ Screen.vm 719 Screen.drawCircle
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 720 Screen.drawCircle
+@2
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 721 Screen.drawCircle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 722 Screen.drawCircle
+@511
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 723 Screen.drawCircle
+@$OS.ARITHMETIC_IF_99$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_99$)
+//@ Screen.vm 724 Screen.drawCircle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ Screen.vm 725 Screen.drawCircle
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 726 Screen.drawCircle
+@2
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 727 Screen.drawCircle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Screen.vm 728 Screen.drawCircle
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 729 Screen.drawCircle
+@$OS.ARITHMETIC_IF_100$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_100$)
+//@ Screen.vm 730 Screen.drawCircle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ Screen.vm 731 Screen.drawCircle
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 732 Screen.drawCircle
+@2
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 733 Screen.drawCircle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 734 Screen.drawCircle
+@255
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 735 Screen.drawCircle
+@$OS.ARITHMETIC_IF_101$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_101$)
+//@ Screen.vm 736 Screen.drawCircle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ Screen.vm 737 Screen.drawCircle
+@SP
+M=M-1
+A=M
+D=M
+@Screen.drawCircle$IF_TRUE1
+D;JNE
+//@ Screen.vm 738 Screen.drawCircle
+@Screen.drawCircle$IF_FALSE1
+0;JMP
+//@ Screen.vm 739 Screen.drawCircle
+(Screen.drawCircle$IF_TRUE1)
+//@ Screen.vm 740 Screen.drawCircle
+@13
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 741 Screen.drawCircle
+@R13
+M=1
+@Sys.error
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_196$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_196$)
+//@ Screen.vm 742 Screen.drawCircle
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Screen.vm 743 Screen.drawCircle
+(Screen.drawCircle$IF_FALSE1)
+//@ Screen.vm 744 Screen.drawCircle
+@2
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 745 Screen.drawCircle
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+M=D
+//@ Screen.vm 746 Screen.drawCircle
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 747 Screen.drawCircle
+@2
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 748 Screen.drawCircle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Screen.vm 749 Screen.drawCircle
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+M=D
+//@ Screen.vm 750 Screen.drawCircle
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 751 Screen.drawCircle
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 752 Screen.drawCircle
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 753 Screen.drawCircle
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 754 Screen.drawCircle
+@4
+D=A
+@R13
+M=D
+@Screen.drawSymetric
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_197$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_197$)
+//@ Screen.vm 755 Screen.drawCircle
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Screen.vm 756 Screen.drawCircle
+(Screen.drawCircle$WHILE_EXP0)
+//@ Screen.vm 757 Screen.drawCircle
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 758 Screen.drawCircle
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 759 Screen.drawCircle
+@$OS.ARITHMETIC_IF_102$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_102$)
+//@ Screen.vm 760 Screen.drawCircle
+@SP
+D=M-1
+A=D
+M=!M
+//@ Screen.vm 761 Screen.drawCircle
+@SP
+M=M-1
+A=M
+D=M
+@Screen.drawCircle$WHILE_END0
+D;JNE
+//@ Screen.vm 762 Screen.drawCircle
+@2
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 763 Screen.drawCircle
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 764 Screen.drawCircle
+@$OS.ARITHMETIC_IF_103$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_103$)
+//@ Screen.vm 765 Screen.drawCircle
+@SP
+M=M-1
+A=M
+D=M
+@Screen.drawCircle$IF_TRUE2
+D;JNE
+//@ Screen.vm 766 Screen.drawCircle
+@Screen.drawCircle$IF_FALSE2
+0;JMP
+//@ Screen.vm 767 Screen.drawCircle
+(Screen.drawCircle$IF_TRUE2)
+//@ Screen.vm 768 Screen.drawCircle
+@2
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 769 Screen.drawCircle
+@2
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 770 Screen.drawCircle
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 771 Screen.drawCircle
+@2
+D=A
+@R13
+M=D
+@Math.multiply
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_198$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_198$)
+//@ Screen.vm 772 Screen.drawCircle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 773 Screen.drawCircle
+@3
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 774 Screen.drawCircle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 775 Screen.drawCircle
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+M=D
+//@ Screen.vm 776 Screen.drawCircle
+@Screen.drawCircle$IF_END2
+0;JMP
+//@ Screen.vm 777 Screen.drawCircle
+(Screen.drawCircle$IF_FALSE2)
+//@ Screen.vm 778 Screen.drawCircle
+@2
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 779 Screen.drawCircle
+@2
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 780 Screen.drawCircle
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 781 Screen.drawCircle
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 782 Screen.drawCircle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Screen.vm 783 Screen.drawCircle
+@2
+D=A
+@R13
+M=D
+@Math.multiply
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_199$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_199$)
+//@ Screen.vm 784 Screen.drawCircle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 785 Screen.drawCircle
+@5
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 786 Screen.drawCircle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 787 Screen.drawCircle
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+M=D
+//@ Screen.vm 788 Screen.drawCircle
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 789 Screen.drawCircle
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 790 Screen.drawCircle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Screen.vm 791 Screen.drawCircle
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+M=D
+//@ Screen.vm 792 Screen.drawCircle
+(Screen.drawCircle$IF_END2)
+//@ Screen.vm 793 Screen.drawCircle
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 794 Screen.drawCircle
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 795 Screen.drawCircle
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ Screen.vm 796 Screen.drawCircle
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Screen.vm 797 Screen.drawCircle
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 798 Screen.drawCircle
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 799 Screen.drawCircle
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 800 Screen.drawCircle
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 801 Screen.drawCircle
+@4
+D=A
+@R13
+M=D
+@Screen.drawSymetric
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_200$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_200$)
+//@ Screen.vm 802 Screen.drawCircle
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Screen.vm 803 Screen.drawCircle
+@Screen.drawCircle$WHILE_EXP0
+0;JMP
+//@ Screen.vm 804 Screen.drawCircle
+(Screen.drawCircle$WHILE_END0)
+//@ Screen.vm 805 Screen.drawCircle
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Screen.vm 806 Screen.drawCircle
+@$OS.RETURN$
+0;JMP
+//@ String.vm 1 String.new
+(String.new)
+D=0
+//@ String.vm 2 String.new
+@3
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 3 String.new
+@R13
+M=1
+@Memory.alloc
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_201$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_201$)
+//@ String.vm 4 String.new
+@SP
+M=M-1
+A=M
+D=M
+@3
+M=D
+//@ String.vm 5 String.new
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 6 String.new
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 7 String.new
+@$OS.ARITHMETIC_IF_104$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_104$)
+//@ String.vm 8 String.new
+@SP
+M=M-1
+A=M
+D=M
+@String.new$IF_TRUE0
+D;JNE
+//@ String.vm 9 String.new
+@String.new$IF_FALSE0
+0;JMP
+//@ String.vm 10 String.new
+(String.new$IF_TRUE0)
+//@ String.vm 11 String.new
+@14
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 12 String.new
+@R13
+M=1
+@Sys.error
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_202$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_202$)
+//@ String.vm 13 String.new
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ String.vm 14 String.new
+(String.new$IF_FALSE0)
+//@ String.vm 15 String.new
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 16 String.new
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 17 String.new
+@$OS.ARITHMETIC_IF_105$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_105$)
+//@ String.vm 18 String.new
+@SP
+M=M-1
+A=M
+D=M
+@String.new$IF_TRUE1
+D;JNE
+//@ String.vm 19 String.new
+@String.new$IF_FALSE1
+0;JMP
+//@ String.vm 20 String.new
+(String.new$IF_TRUE1)
+//@ String.vm 21 String.new
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 22 String.new
+@R13
+M=1
+@Array.new
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_203$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_203$)
+//@ String.vm 23 String.new
+@SP
+M=M-1
+A=M
+D=M
+@THIS
+A=M
+A=A+1
+M=D
+//@ String.vm 24 String.new
+(String.new$IF_FALSE1)
+//@ String.vm 25 String.new
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 26 String.new
+@SP
+M=M-1
+A=M
+D=M
+@THIS
+A=M
+M=D
+//@ String.vm 27 String.new
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 28 String.new
+@SP
+M=M-1
+A=M
+D=M
+@THIS
+A=M
+A=A+1
+A=A+1
+M=D
+//@ String.vm 29 String.new
+@3
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 30 String.new
+@$OS.RETURN$
+0;JMP
+//@ String.vm 31 String.dispose
+(String.dispose)
+D=0
+//@ String.vm 32 String.dispose
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 33 String.dispose
+@SP
+M=M-1
+A=M
+D=M
+@3
+M=D
+//@ String.vm 34 String.dispose
+@THIS
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 35 String.dispose
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 36 String.dispose
+@$OS.ARITHMETIC_IF_106$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_106$)
+//@ String.vm 37 String.dispose
+@SP
+M=M-1
+A=M
+D=M
+@String.dispose$IF_TRUE0
+D;JNE
+//@ String.vm 38 String.dispose
+@String.dispose$IF_FALSE0
+0;JMP
+//@ String.vm 39 String.dispose
+(String.dispose$IF_TRUE0)
+//@ String.vm 40 String.dispose
+@THIS
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 41 String.dispose
+@R13
+M=1
+@Array.dispose
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_204$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_204$)
+//@ String.vm 42 String.dispose
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ String.vm 43 String.dispose
+(String.dispose$IF_FALSE0)
+//@ String.vm 44 String.dispose
+@3
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 45 String.dispose
+@R13
+M=1
+@Memory.deAlloc
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_205$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_205$)
+//@ String.vm 46 String.dispose
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ String.vm 47 String.dispose
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 48 String.dispose
+@$OS.RETURN$
+0;JMP
+//@ String.vm 49 String.length
+(String.length)
+D=0
+//@ String.vm 50 String.length
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 51 String.length
+@SP
+M=M-1
+A=M
+D=M
+@3
+M=D
+//@ String.vm 52 String.length
+@2
+D=A
+@THIS
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 53 String.length
+@$OS.RETURN$
+0;JMP
+//@ String.vm 54 String.charAt
+(String.charAt)
+D=0
+//@ String.vm 55 String.charAt
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 56 String.charAt
+@SP
+M=M-1
+A=M
+D=M
+@3
+M=D
+//@ String.vm 57 String.charAt
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 58 String.charAt
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 59 String.charAt
+@$OS.ARITHMETIC_IF_107$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_107$)
+//@ String.vm 60 String.charAt
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 61 String.charAt
+@2
+D=A
+@THIS
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 62 String.charAt
+@$OS.ARITHMETIC_IF_108$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_108$)
+//@ String.vm 63 String.charAt
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ String.vm 64 String.charAt
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 65 String.charAt
+@2
+D=A
+@THIS
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 66 String.charAt
+@$OS.ARITHMETIC_IF_109$
+D=A
+@$OS.EQ$
+0;JMP
+($OS.ARITHMETIC_IF_109$)
+//@ String.vm 67 String.charAt
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ String.vm 68 String.charAt
+@SP
+M=M-1
+A=M
+D=M
+@String.charAt$IF_TRUE0
+D;JNE
+//@ String.vm 69 String.charAt
+@String.charAt$IF_FALSE0
+0;JMP
+//@ String.vm 70 String.charAt
+(String.charAt$IF_TRUE0)
+//@ String.vm 71 String.charAt
+@15
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 72 String.charAt
+@R13
+M=1
+@Sys.error
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_206$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_206$)
+//@ String.vm 73 String.charAt
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ String.vm 74 String.charAt
+(String.charAt$IF_FALSE0)
+//@ String.vm 75 String.charAt
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 76 String.charAt
+@THIS
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 77 String.charAt
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ String.vm 78 String.charAt
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ String.vm 79 String.charAt
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 80 String.charAt
+@$OS.RETURN$
+0;JMP
+//@ String.vm 81 String.setCharAt
+(String.setCharAt)
+D=0
+//@ String.vm 82 String.setCharAt
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 83 String.setCharAt
+@SP
+M=M-1
+A=M
+D=M
+@3
+M=D
+//@ String.vm 84 String.setCharAt
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 85 String.setCharAt
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 86 String.setCharAt
+@$OS.ARITHMETIC_IF_110$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_110$)
+//@ String.vm 87 String.setCharAt
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 88 String.setCharAt
+@2
+D=A
+@THIS
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 89 String.setCharAt
+@$OS.ARITHMETIC_IF_111$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_111$)
+//@ String.vm 90 String.setCharAt
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ String.vm 91 String.setCharAt
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 92 String.setCharAt
+@2
+D=A
+@THIS
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 93 String.setCharAt
+@$OS.ARITHMETIC_IF_112$
+D=A
+@$OS.EQ$
+0;JMP
+($OS.ARITHMETIC_IF_112$)
+//@ String.vm 94 String.setCharAt
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ String.vm 95 String.setCharAt
+@SP
+M=M-1
+A=M
+D=M
+@String.setCharAt$IF_TRUE0
+D;JNE
+//@ String.vm 96 String.setCharAt
+@String.setCharAt$IF_FALSE0
+0;JMP
+//@ String.vm 97 String.setCharAt
+(String.setCharAt$IF_TRUE0)
+//@ String.vm 98 String.setCharAt
+@16
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 99 String.setCharAt
+@R13
+M=1
+@Sys.error
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_207$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_207$)
+//@ String.vm 100 String.setCharAt
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ String.vm 101 String.setCharAt
+(String.setCharAt$IF_FALSE0)
+//@ String.vm 102 String.setCharAt
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 103 String.setCharAt
+@THIS
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 104 String.setCharAt
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ String.vm 105 String.setCharAt
+@2
+D=A
+@ARG
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 106 String.setCharAt
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ String.vm 107 String.setCharAt
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ String.vm 108 String.setCharAt
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 109 String.setCharAt
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ String.vm 110 String.setCharAt
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 111 String.setCharAt
+@$OS.RETURN$
+0;JMP
+//@ String.vm 112 String.appendChar
+(String.appendChar)
+D=0
+//@ String.vm 113 String.appendChar
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 114 String.appendChar
+@SP
+M=M-1
+A=M
+D=M
+@3
+M=D
+//@ String.vm 115 String.appendChar
+@2
+D=A
+@THIS
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 116 String.appendChar
+@THIS
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 117 String.appendChar
+@$OS.ARITHMETIC_IF_113$
+D=A
+@$OS.EQ$
+0;JMP
+($OS.ARITHMETIC_IF_113$)
+//@ String.vm 118 String.appendChar
+@SP
+M=M-1
+A=M
+D=M
+@String.appendChar$IF_TRUE0
+D;JNE
+//@ String.vm 119 String.appendChar
+@String.appendChar$IF_FALSE0
+0;JMP
+//@ String.vm 120 String.appendChar
+(String.appendChar$IF_TRUE0)
+//@ String.vm 121 String.appendChar
+@17
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 122 String.appendChar
+@R13
+M=1
+@Sys.error
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_208$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_208$)
+//@ String.vm 123 String.appendChar
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ String.vm 124 String.appendChar
+(String.appendChar$IF_FALSE0)
+//@ String.vm 125 String.appendChar
+@2
+D=A
+@THIS
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 126 String.appendChar
+@THIS
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 127 String.appendChar
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ String.vm 128 String.appendChar
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 129 String.appendChar
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ String.vm 130 String.appendChar
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ String.vm 131 String.appendChar
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 132 String.appendChar
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ String.vm 133 String.appendChar
+@2
+D=A
+@THIS
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 134 String.appendChar
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 135 String.appendChar
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ String.vm 136 String.appendChar
+@SP
+M=M-1
+A=M
+D=M
+@THIS
+A=M
+A=A+1
+A=A+1
+M=D
+//@ String.vm 137 String.appendChar
+@3
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 138 String.appendChar
+@$OS.RETURN$
+0;JMP
+//@ String.vm 139 String.eraseLastChar
+(String.eraseLastChar)
+D=0
+//@ String.vm 140 String.eraseLastChar
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 141 String.eraseLastChar
+@SP
+M=M-1
+A=M
+D=M
+@3
+M=D
+//@ String.vm 142 String.eraseLastChar
+@2
+D=A
+@THIS
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 143 String.eraseLastChar
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 144 String.eraseLastChar
+@$OS.ARITHMETIC_IF_114$
+D=A
+@$OS.EQ$
+0;JMP
+($OS.ARITHMETIC_IF_114$)
+//@ String.vm 145 String.eraseLastChar
+@SP
+M=M-1
+A=M
+D=M
+@String.eraseLastChar$IF_TRUE0
+D;JNE
+//@ String.vm 146 String.eraseLastChar
+@String.eraseLastChar$IF_FALSE0
+0;JMP
+//@ String.vm 147 String.eraseLastChar
+(String.eraseLastChar$IF_TRUE0)
+//@ String.vm 148 String.eraseLastChar
+@18
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 149 String.eraseLastChar
+@R13
+M=1
+@Sys.error
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_209$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_209$)
+//@ String.vm 150 String.eraseLastChar
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ String.vm 151 String.eraseLastChar
+(String.eraseLastChar$IF_FALSE0)
+//@ String.vm 152 String.eraseLastChar
+@2
+D=A
+@THIS
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 153 String.eraseLastChar
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 154 String.eraseLastChar
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ String.vm 155 String.eraseLastChar
+@SP
+M=M-1
+A=M
+D=M
+@THIS
+A=M
+A=A+1
+A=A+1
+M=D
+//@ String.vm 156 String.eraseLastChar
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 157 String.eraseLastChar
+@$OS.RETURN$
+0;JMP
+//@ String.vm 158 String.intValue
+(String.intValue)
+D=0
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 159 String.intValue
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 160 String.intValue
+@SP
+M=M-1
+A=M
+D=M
+@3
+M=D
+//@ String.vm 161 String.intValue
+@2
+D=A
+@THIS
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 162 String.intValue
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 163 String.intValue
+@$OS.ARITHMETIC_IF_115$
+D=A
+@$OS.EQ$
+0;JMP
+($OS.ARITHMETIC_IF_115$)
+//@ String.vm 164 String.intValue
+@SP
+M=M-1
+A=M
+D=M
+@String.intValue$IF_TRUE0
+D;JNE
+//@ String.vm 165 String.intValue
+@String.intValue$IF_FALSE0
+0;JMP
+//@ String.vm 166 String.intValue
+(String.intValue$IF_TRUE0)
+//@ String.vm 167 String.intValue
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 168 String.intValue
+@$OS.RETURN$
+0;JMP
+//@ String.vm 169 String.intValue
+(String.intValue$IF_FALSE0)
+//@ String.vm 170 String.intValue
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 171 String.intValue
+@SP
+D=M-1
+A=D
+M=!M
+//@ String.vm 172 String.intValue
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+A=A+1
+M=D
+//@ String.vm 173 String.intValue
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 174 String.intValue
+@THIS
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 175 String.intValue
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ String.vm 176 String.intValue
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ String.vm 177 String.intValue
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 178 String.intValue
+@45
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 179 String.intValue
+@$OS.ARITHMETIC_IF_116$
+D=A
+@$OS.EQ$
+0;JMP
+($OS.ARITHMETIC_IF_116$)
+//@ String.vm 180 String.intValue
+@SP
+M=M-1
+A=M
+D=M
+@String.intValue$IF_TRUE1
+D;JNE
+//@ String.vm 181 String.intValue
+@String.intValue$IF_FALSE1
+0;JMP
+//@ String.vm 182 String.intValue
+(String.intValue$IF_TRUE1)
+//@ String.vm 183 String.intValue
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 184 String.intValue
+@SP
+D=M-1
+A=D
+M=!M
+//@ String.vm 185 String.intValue
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+A=A+1
+A=A+1
+M=D
+//@ String.vm 186 String.intValue
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 187 String.intValue
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ String.vm 188 String.intValue
+(String.intValue$IF_FALSE1)
+//@ String.vm 189 String.intValue
+(String.intValue$WHILE_EXP0)
+//@ String.vm 190 String.intValue
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 191 String.intValue
+@2
+D=A
+@THIS
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 192 String.intValue
+@$OS.ARITHMETIC_IF_117$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_117$)
+//@ String.vm 193 String.intValue
+@3
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 194 String.intValue
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M&D
+//@ String.vm 195 String.intValue
+@SP
+D=M-1
+A=D
+M=!M
+//@ String.vm 196 String.intValue
+@SP
+M=M-1
+A=M
+D=M
+@String.intValue$WHILE_END0
+D;JNE
+//@ String.vm 197 String.intValue
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 198 String.intValue
+@THIS
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 199 String.intValue
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ String.vm 200 String.intValue
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ String.vm 201 String.intValue
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 202 String.intValue
+@48
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 203 String.intValue
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ String.vm 204 String.intValue
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+M=D
+//@ String.vm 205 String.intValue
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 206 String.intValue
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 207 String.intValue
+@$OS.ARITHMETIC_IF_118$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_118$)
+//@ String.vm 208 String.intValue
+@2
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 209 String.intValue
+@9
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 210 String.intValue
+@$OS.ARITHMETIC_IF_119$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_119$)
+//@ String.vm 211 String.intValue
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M|D
+//@ String.vm 212 String.intValue
+@SP
+D=M-1
+A=D
+M=!M
+//@ String.vm 213 String.intValue
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+A=A+1
+M=D
+//@ String.vm 214 String.intValue
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 215 String.intValue
+@SP
+M=M-1
+A=M
+D=M
+@String.intValue$IF_TRUE2
+D;JNE
+//@ String.vm 216 String.intValue
+@String.intValue$IF_FALSE2
+0;JMP
+//@ String.vm 217 String.intValue
+(String.intValue$IF_TRUE2)
+//@ String.vm 218 String.intValue
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 219 String.intValue
+@10
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 220 String.intValue
+@2
+D=A
+@R13
+M=D
+@Math.multiply
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_210$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_210$)
+//@ String.vm 221 String.intValue
+@2
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 222 String.intValue
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ String.vm 223 String.intValue
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+M=D
+//@ String.vm 224 String.intValue
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 225 String.intValue
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 226 String.intValue
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ String.vm 227 String.intValue
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ String.vm 228 String.intValue
+(String.intValue$IF_FALSE2)
+//@ String.vm 229 String.intValue
+@String.intValue$WHILE_EXP0
+0;JMP
+//@ String.vm 230 String.intValue
+(String.intValue$WHILE_END0)
+//@ String.vm 231 String.intValue
+@4
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 232 String.intValue
+@SP
+M=M-1
+A=M
+D=M
+@String.intValue$IF_TRUE3
+D;JNE
+//@ String.vm 233 String.intValue
+@String.intValue$IF_FALSE3
+0;JMP
+//@ String.vm 234 String.intValue
+(String.intValue$IF_TRUE3)
+//@ String.vm 235 String.intValue
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 236 String.intValue
+@SP
+D=M-1
+A=D
+M=-M
+//@ String.vm 237 String.intValue
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+M=D
+//@ String.vm 238 String.intValue
+(String.intValue$IF_FALSE3)
+//@ String.vm 239 String.intValue
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 240 String.intValue
+@$OS.RETURN$
+0;JMP
+//@ String.vm 241 String.setInt
+(String.setInt)
+D=0
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 242 String.setInt
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 243 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@3
+M=D
+//@ String.vm 244 String.setInt
+@THIS
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 245 String.setInt
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 246 String.setInt
+@$OS.ARITHMETIC_IF_120$
+D=A
+@$OS.EQ$
+0;JMP
+($OS.ARITHMETIC_IF_120$)
+//@ String.vm 247 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@String.setInt$IF_TRUE0
+D;JNE
+//@ String.vm 248 String.setInt
+@String.setInt$IF_FALSE0
+0;JMP
+//@ String.vm 249 String.setInt
+(String.setInt$IF_TRUE0)
+//@ String.vm 250 String.setInt
+@19
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 251 String.setInt
+@R13
+M=1
+@Sys.error
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_211$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_211$)
+//@ String.vm 252 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ String.vm 253 String.setInt
+(String.setInt$IF_FALSE0)
+//@ String.vm 254 String.setInt
+@6
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 255 String.setInt
+@R13
+M=1
+@Array.new
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_212$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_212$)
+//@ String.vm 256 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+M=D
+//@ String.vm 257 String.setInt
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 258 String.setInt
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 259 String.setInt
+@$OS.ARITHMETIC_IF_121$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_121$)
+//@ String.vm 260 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@String.setInt$IF_TRUE1
+D;JNE
+//@ String.vm 261 String.setInt
+@String.setInt$IF_FALSE1
+0;JMP
+//@ String.vm 262 String.setInt
+(String.setInt$IF_TRUE1)
+//@ String.vm 263 String.setInt
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 264 String.setInt
+@SP
+D=M-1
+A=D
+M=!M
+//@ String.vm 265 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+A=A+1
+A=A+1
+M=D
+//@ String.vm 266 String.setInt
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 267 String.setInt
+@SP
+D=M-1
+A=D
+M=-M
+//@ String.vm 268 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@ARG
+A=M
+A=A+1
+M=D
+//@ String.vm 269 String.setInt
+(String.setInt$IF_FALSE1)
+//@ String.vm 270 String.setInt
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 271 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+M=D
+//@ String.vm 272 String.setInt
+(String.setInt$WHILE_EXP0)
+//@ String.vm 273 String.setInt
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 274 String.setInt
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 275 String.setInt
+@$OS.ARITHMETIC_IF_122$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_122$)
+//@ String.vm 276 String.setInt
+@SP
+D=M-1
+A=D
+M=!M
+//@ String.vm 277 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@String.setInt$WHILE_END0
+D;JNE
+//@ String.vm 278 String.setInt
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 279 String.setInt
+@10
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 280 String.setInt
+@2
+D=A
+@R13
+M=D
+@Math.divide
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_213$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_213$)
+//@ String.vm 281 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+A=A+1
+M=D
+//@ String.vm 282 String.setInt
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 283 String.setInt
+@2
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 284 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ String.vm 285 String.setInt
+@48
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 286 String.setInt
+@ARG
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 287 String.setInt
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 288 String.setInt
+@10
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 289 String.setInt
+@2
+D=A
+@R13
+M=D
+@Math.multiply
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_214$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_214$)
+//@ String.vm 290 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ String.vm 291 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ String.vm 292 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ String.vm 293 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ String.vm 294 String.setInt
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 295 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ String.vm 296 String.setInt
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 297 String.setInt
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 298 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ String.vm 299 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ String.vm 300 String.setInt
+@LCL
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 301 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@ARG
+A=M
+A=A+1
+M=D
+//@ String.vm 302 String.setInt
+@String.setInt$WHILE_EXP0
+0;JMP
+//@ String.vm 303 String.setInt
+(String.setInt$WHILE_END0)
+//@ String.vm 304 String.setInt
+@3
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 305 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@String.setInt$IF_TRUE2
+D;JNE
+//@ String.vm 306 String.setInt
+@String.setInt$IF_FALSE2
+0;JMP
+//@ String.vm 307 String.setInt
+(String.setInt$IF_TRUE2)
+//@ String.vm 308 String.setInt
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 309 String.setInt
+@2
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 310 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ String.vm 311 String.setInt
+@45
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 312 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ String.vm 313 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ String.vm 314 String.setInt
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 315 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ String.vm 316 String.setInt
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 317 String.setInt
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 318 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ String.vm 319 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ String.vm 320 String.setInt
+(String.setInt$IF_FALSE2)
+//@ String.vm 321 String.setInt
+@THIS
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 322 String.setInt
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 323 String.setInt
+@$OS.ARITHMETIC_IF_123$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_123$)
+//@ String.vm 324 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@String.setInt$IF_TRUE3
+D;JNE
+//@ String.vm 325 String.setInt
+@String.setInt$IF_FALSE3
+0;JMP
+//@ String.vm 326 String.setInt
+(String.setInt$IF_TRUE3)
+//@ String.vm 327 String.setInt
+@19
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 328 String.setInt
+@R13
+M=1
+@Sys.error
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_215$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_215$)
+//@ String.vm 329 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ String.vm 330 String.setInt
+(String.setInt$IF_FALSE3)
+//@ String.vm 331 String.setInt
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 332 String.setInt
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 333 String.setInt
+@$OS.ARITHMETIC_IF_124$
+D=A
+@$OS.EQ$
+0;JMP
+($OS.ARITHMETIC_IF_124$)
+//@ String.vm 334 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@String.setInt$IF_TRUE4
+D;JNE
+//@ String.vm 335 String.setInt
+@String.setInt$IF_FALSE4
+0;JMP
+//@ String.vm 336 String.setInt
+(String.setInt$IF_TRUE4)
+//@ String.vm 337 String.setInt
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 338 String.setInt
+@THIS
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 339 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ String.vm 340 String.setInt
+@48
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 341 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ String.vm 342 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ String.vm 343 String.setInt
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 344 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ String.vm 345 String.setInt
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 346 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@THIS
+A=M
+A=A+1
+A=A+1
+M=D
+//@ String.vm 347 String.setInt
+@String.setInt$IF_END4
+0;JMP
+//@ String.vm 348 String.setInt
+(String.setInt$IF_FALSE4)
+//@ String.vm 349 String.setInt
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 350 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@THIS
+A=M
+A=A+1
+A=A+1
+M=D
+//@ String.vm 351 String.setInt
+(String.setInt$WHILE_EXP1)
+//@ String.vm 352 String.setInt
+@2
+D=A
+@THIS
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 353 String.setInt
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 354 String.setInt
+@$OS.ARITHMETIC_IF_125$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_125$)
+//@ String.vm 355 String.setInt
+@SP
+D=M-1
+A=D
+M=!M
+//@ String.vm 356 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@String.setInt$WHILE_END1
+D;JNE
+//@ String.vm 357 String.setInt
+@2
+D=A
+@THIS
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 358 String.setInt
+@THIS
+A=M+1
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 359 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ String.vm 360 String.setInt
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 361 String.setInt
+@2
+D=A
+@THIS
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 362 String.setInt
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 363 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ String.vm 364 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ String.vm 365 String.setInt
+@2
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 366 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ String.vm 367 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ String.vm 368 String.setInt
+@THAT
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 369 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ String.vm 370 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@4
+M=D
+//@ String.vm 371 String.setInt
+@5
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 372 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@THAT
+A=M
+M=D
+//@ String.vm 373 String.setInt
+@2
+D=A
+@THIS
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 374 String.setInt
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 375 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M+D
+//@ String.vm 376 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@THIS
+A=M
+A=A+1
+A=A+1
+M=D
+//@ String.vm 377 String.setInt
+@String.setInt$WHILE_EXP1
+0;JMP
+//@ String.vm 378 String.setInt
+(String.setInt$WHILE_END1)
+//@ String.vm 379 String.setInt
+(String.setInt$IF_END4)
+//@ String.vm 380 String.setInt
+@2
+D=A
+@LCL
+A=M+D
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 381 String.setInt
+@R13
+M=1
+@Array.dispose
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_216$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_216$)
+//@ String.vm 382 String.setInt
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ String.vm 383 String.setInt
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 384 String.setInt
+@$OS.RETURN$
+0;JMP
+//@ String.vm 385 String.newLine
+(String.newLine)
+D=0
+//@ String.vm 386 String.newLine
+@128
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 387 String.newLine
+@$OS.RETURN$
+0;JMP
+//@ String.vm 388 String.backSpace
+(String.backSpace)
+D=0
+//@ String.vm 389 String.backSpace
+@129
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 390 String.backSpace
+@$OS.RETURN$
+0;JMP
+//@ String.vm 391 String.doubleQuote
+(String.doubleQuote)
+D=0
+//@ String.vm 392 String.doubleQuote
+@34
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ String.vm 393 String.doubleQuote
+@$OS.RETURN$
+0;JMP
+//@ Sys.vm 1 Sys.init
+(Sys.init)
+D=0
+//@ Sys.vm 2 Sys.init
+@R13
+M=0
+@Memory.init
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_217$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_217$)
+//@ Sys.vm 3 Sys.init
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Sys.vm 4 Sys.init
+@R13
+M=0
+@Math.init
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_218$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_218$)
+//@ Sys.vm 5 Sys.init
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Sys.vm 6 Sys.init
+@R13
+M=0
+@Screen.init
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_219$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_219$)
+//@ Sys.vm 7 Sys.init
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Sys.vm 8 Sys.init
+@R13
+M=0
+@Output.init
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_220$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_220$)
+//@ Sys.vm 9 Sys.init
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Sys.vm 10 Sys.init
+@R13
+M=0
+@Keyboard.init
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_221$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_221$)
+//@ Sys.vm 11 Sys.init
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Sys.vm 12 Sys.init
+@R13
+M=0
+@Main.main
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_222$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_222$)
+//@ Sys.vm 13 Sys.init
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Sys.vm 14 Sys.init
+@R13
+M=0
+@Sys.halt
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_223$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_223$)
+//@ Sys.vm 15 Sys.init
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Sys.vm 16 Sys.init
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Sys.vm 17 Sys.init
+@$OS.RETURN$
+0;JMP
+//@ Sys.vm 18 Sys.halt
+(Sys.halt)
+D=0
+//@ Sys.vm 19 Sys.halt
+(Sys.halt$WHILE_EXP0)
+//@ Sys.vm 20 Sys.halt
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Sys.vm 21 Sys.halt
+@SP
+D=M-1
+A=D
+M=!M
+//@ Sys.vm 22 Sys.halt
+@SP
+D=M-1
+A=D
+M=!M
+//@ Sys.vm 23 Sys.halt
+@SP
+M=M-1
+A=M
+D=M
+@Sys.halt$WHILE_END0
+D;JNE
+//@ Sys.vm 24 Sys.halt
+@Sys.halt$WHILE_EXP0
+0;JMP
+//@ Sys.vm 25 Sys.halt
+(Sys.halt$WHILE_END0)
+//@ Sys.vm 26 Sys.halt
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Sys.vm 27 Sys.halt
+@$OS.RETURN$
+0;JMP
+//@ Sys.vm 28 Sys.wait
+(Sys.wait)
+D=0
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Sys.vm 29 Sys.wait
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Sys.vm 30 Sys.wait
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Sys.vm 31 Sys.wait
+@$OS.ARITHMETIC_IF_126$
+D=A
+@$OS.LT$
+0;JMP
+($OS.ARITHMETIC_IF_126$)
+//@ Sys.vm 32 Sys.wait
+@SP
+M=M-1
+A=M
+D=M
+@Sys.wait$IF_TRUE0
+D;JNE
+//@ Sys.vm 33 Sys.wait
+@Sys.wait$IF_FALSE0
+0;JMP
+//@ Sys.vm 34 Sys.wait
+(Sys.wait$IF_TRUE0)
+//@ Sys.vm 35 Sys.wait
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Sys.vm 36 Sys.wait
+@R13
+M=1
+@Sys.error
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_224$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_224$)
+//@ Sys.vm 37 Sys.wait
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Sys.vm 38 Sys.wait
+(Sys.wait$IF_FALSE0)
+//@ Sys.vm 39 Sys.wait
+(Sys.wait$WHILE_EXP0)
+//@ Sys.vm 40 Sys.wait
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Sys.vm 41 Sys.wait
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Sys.vm 42 Sys.wait
+@$OS.ARITHMETIC_IF_127$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_127$)
+//@ Sys.vm 43 Sys.wait
+@SP
+D=M-1
+A=D
+M=!M
+//@ Sys.vm 44 Sys.wait
+@SP
+M=M-1
+A=M
+D=M
+@Sys.wait$WHILE_END0
+D;JNE
+//@ Sys.vm 45 Sys.wait
+@50
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Sys.vm 46 Sys.wait
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Sys.vm 47 Sys.wait
+(Sys.wait$WHILE_EXP1)
+//@ Sys.vm 48 Sys.wait
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Sys.vm 49 Sys.wait
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Sys.vm 50 Sys.wait
+@$OS.ARITHMETIC_IF_128$
+D=A
+@$OS.GT$
+0;JMP
+($OS.ARITHMETIC_IF_128$)
+//@ Sys.vm 51 Sys.wait
+@SP
+D=M-1
+A=D
+M=!M
+//@ Sys.vm 52 Sys.wait
+@SP
+M=M-1
+A=M
+D=M
+@Sys.wait$WHILE_END1
+D;JNE
+//@ Sys.vm 53 Sys.wait
+@LCL
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Sys.vm 54 Sys.wait
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Sys.vm 55 Sys.wait
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Sys.vm 56 Sys.wait
+@SP
+M=M-1
+A=M
+D=M
+@LCL
+A=M
+M=D
+//@ Sys.vm 57 Sys.wait
+@Sys.wait$WHILE_EXP1
+0;JMP
+//@ Sys.vm 58 Sys.wait
+(Sys.wait$WHILE_END1)
+//@ Sys.vm 59 Sys.wait
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Sys.vm 60 Sys.wait
+@1
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Sys.vm 61 Sys.wait
+@SP
+M=M-1
+A=M
+D=M
+A=A-1
+M=M-D
+//@ Sys.vm 62 Sys.wait
+@SP
+M=M-1
+A=M
+D=M
+@ARG
+A=M
+M=D
+//@ Sys.vm 63 Sys.wait
+@Sys.wait$WHILE_EXP0
+0;JMP
+//@ Sys.vm 64 Sys.wait
+(Sys.wait$WHILE_END0)
+//@ Sys.vm 65 Sys.wait
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Sys.vm 66 Sys.wait
+@$OS.RETURN$
+0;JMP
+//@ Sys.vm 67 Sys.error
+(Sys.error)
+D=0
+//@ Sys.vm 68 Sys.error
+@69
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Sys.vm 69 Sys.error
+@R13
+M=1
+@Output.printChar
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_225$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_225$)
+//@ Sys.vm 70 Sys.error
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Sys.vm 71 Sys.error
+@82
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Sys.vm 72 Sys.error
+@R13
+M=1
+@Output.printChar
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_226$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_226$)
+//@ Sys.vm 73 Sys.error
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Sys.vm 74 Sys.error
+@82
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Sys.vm 75 Sys.error
+@R13
+M=1
+@Output.printChar
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_227$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_227$)
+//@ Sys.vm 76 Sys.error
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Sys.vm 77 Sys.error
+@ARG
+A=M
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Sys.vm 78 Sys.error
+@R13
+M=1
+@Output.printInt
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_228$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_228$)
+//@ Sys.vm 79 Sys.error
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Sys.vm 80 Sys.error
+@R13
+M=0
+@Sys.halt
+D=A
+@R14
+M=D
+@$OS.RETURN_ADDRESS_229$
+D=A
+@$OS.CALL$
+0;JMP
+($OS.RETURN_ADDRESS_229$)
+//@ Sys.vm 81 Sys.error
+@SP
+M=M-1
+A=M
+D=M
+@5
+M=D
+//@ Sys.vm 82 Sys.error
+@0
+D=A
+@SP
+M=M+1
+A=M-1
+M=D
+//@ Sys.vm 83 Sys.error
+@$OS.RETURN$
+0;JMP
+//@ - 0 (halt)
+($OS.END$)
+@$OS.END$
+0;JMP
+//@ - 0 (call)
+($OS.CALL$)
+@SP
+M=M+1
+A=M-1
+M=D
+@LCL
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+@ARG
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+@THIS
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+@THAT
+D=M
+@SP
+M=M+1
+A=M-1
+M=D
+@SP
+D=M
+@LCL
+M=D
+@R13
+D=D-M
+@5
+D=D-A
+@ARG
+M=D
+@R14
+A=M
+0;JMP
+//@ - 0 (return)
+($OS.RETURN$)
+@LCL
+D=M
+@R13
+M=D
+@5
+D=D-A
+A=D
+D=M
+@R14
+M=D
+@SP
+M=M-1
+A=M
+D=M
+@ARG
+A=M
+M=D
+D=A+1
+@SP
+M=D
+@R13
+D=M
+@1
+D=D-A
+A=D
+D=M
+@THAT
+M=D
+@R13
+D=M
+@2
+D=D-A
+A=D
+D=M
+@THIS
+M=D
+@R13
+D=M
+@3
+D=D-A
+A=D
+D=M
+@ARG
+M=D
+@R13
+D=M
+@4
+D=D-A
+A=D
+D=M
+@LCL
+M=D
+@R14
+A=M
+0;JMP
+//@ - 0 (compare)
+($OS.EQ$)
+@R15
+M=D
+@SP
+AM=M-1
+D=M
+A=A-1
+D=M-D
+M=-1
+@$OS.EQ_TRUE$
+D;JEQ
+@SP
+A=M-1
+M=0
+($OS.EQ_TRUE$)
+@R15
+A=M
+0;JMP
+//@ - 0 (compare)
+($OS.GT$)
+@R15
+M=D
+@SP
+AM=M-1
+D=M
+A=A-1
+D=M-D
+M=-1
+@$OS.GT_TRUE$
+D;JGT
+@SP
+A=M-1
+M=0
+($OS.GT_TRUE$)
+@R15
+A=M
+0;JMP
+//@ - 0 (compare)
+($OS.LT$)
+@R15
+M=D
+@SP
+AM=M-1
+D=M
+A=A-1
+D=M-D
+M=-1
+@$OS.LT_TRUE$
+D;JLT
+@SP
+A=M-1
+M=0
+($OS.LT_TRUE$)
+@R15
+A=M
+0;JMP
@@ -0,0 +1,1072 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <filesystem>
+#include <chrono>
+#include <cstdint>
+#include <cctype>
+#include <iomanip>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+using namespace std;
+namespace fs = filesystem;
+
+// the netlist of one chip as C++, written by --aot
+#ifdef HDLSIM_AOT
+#include HDLSIM_AOT
+#endif
+
+// a pin or wire of a part, with an optional sub-bus: a, a[3], a[0..7]. lo is -1 for the whole bus
+struct Bus {
+	string name;
+	int lo = -1, hi = -1;
+};
+
+struct Pin {
+	string name;
+	int width;
+};
+
+struct Part {
+	string chip;
+	vector<pair<Bus, Bus> > connections; // part pin = wire of the chip
+	int line;
+};
+
+struct Chip {
+	string name;
+	string file;
+	vector<Pin> inputs, outputs;
+	vector<Part> parts;
+};
+
+class HdlParser {
+private:
+	string file, text, token;
+	size_t pos = 0;
+	int line = 1;
+
+	[[noreturn]] void Error(const string& message) {
+		throw runtime_error(file + ":" + to_string(line) + ": " + message);
+	}
+	void Next() {
+		for (;;) {
+			while (pos < text.size() && isspace((unsigned char)text[pos]))
+				if (text[pos++] == '\n') ++line;
+			if (text.compare(pos, 2, "//") == 0) {
+				pos = text.find('\n', pos);
+				if (pos == string::npos) pos = text.size();
+			} else if (text.compare(pos, 2, "/*") == 0) {
+				size_t end = text.find("*/", pos + 2);
+				if (end == string::npos) Error("unterminated comment");
+				line += (int)count(text.begin() + pos, text.begin() + end, '\n');
+				pos = end + 2;
+			} else break;
+		}
+		size_t start = pos;
+		if (pos >= text.size()) token = "";
+		else if (isalnum((unsigned char)text[pos]) || text[pos] == '_') {
+			while (pos < text.size() && (isalnum((unsigned char)text[pos]) || text[pos] == '_')) ++pos;
+			token = text.substr(start, pos - start);
+		} else if (text.compare(pos, 2, "..") == 0) {
+			pos += 2;
+			token = "..";
+		} else token = text.substr(pos++, 1);
+	}
+	void Expect(const string& s) {
+		if (token != s) Error("expected '" + s + "' but found '" + token + "'");
+		Next();
+	}
+	string Name() {
+		if (token.empty() || !(isalpha((unsigned char)token[0]) || token[0] == '_')) Error("expected a name but found '" + token + "'");
+		string name = token;
+		Next();
+		return name;
+	}
+	int Number() {
+		if (token.empty() || !isdigit((unsigned char)token[0])) Error("expected a number but found '" + token + "'");
+		int n = stoi(token);
+		Next();
+		return n;
+	}
+	Bus ParseBus() {
+		Bus bus;
+		bus.name = Name();
+		if (token == "[") {
+			Next();
+			bus.lo = bus.hi = Number();
+			if (token == "..") {
+				Next();
+				bus.hi = Number();
+			}
+			Expect("]");
+			if (bus.hi < bus.lo) Error("sub-bus " + bus.name + " runs backwards");
+		}
+		return bus;
+	}
+	vector<Pin> ParsePins() {
+		vector<Pin> pins;
+		for (;;) {
+			Pin pin{ Name(), 1 };
+			if (token == "[") {
+				Next();
+				pin.width = Number();
+				Expect("]");
+				if (pin.width < 1 || pin.width > 16) Error("pin " + pin.name + " is not 1 to 16 bits wide");
+			}
+			pins.push_back(pin);
+			if (token != ",") break;
+			Next();
+		}
+		Expect(";");
+		return pins;
+	}
+public:
+	Chip Parse(const string& filename) {
+		ifstream ifs(filename);
+		if (!ifs) throw runtime_error("cannot open " + filename);
+		file = filename;
+		text.assign(istreambuf_iterator<char>(ifs), istreambuf_iterator<char>());
+		pos = 0;
+		line = 1;
+		Next();
+
+		Chip chip;
+		chip.file = filename;
+		Expect("CHIP");
+		chip.name = Name();
+		Expect("{");
+		if (token == "IN") {
+			Next();
+			chip.inputs = ParsePins();
+		}
+		if (token == "OUT") {
+			Next();
+			chip.outputs = ParsePins();
+		}
+		if (token == "BUILTIN") Error("only Nand, DFF and the memory chips are built in");
+		Expect("PARTS");
+		Expect(":");
+		while (token != "}") {
+			if (token.empty()) Error("missing '}'");
+			Part part;
+			part.line = line;
+			part.chip = Name();
+			Expect("(");
+			for (;;) {
+				Bus pin = ParseBus();
+				Expect("=");
+				Bus wire = ParseBus();
+				part.connections.push_back({ pin, wire });
+				if (token != ",") break;
+				Next();
+			}
+			Expect(")");
+			Expect(";");
+			chip.parts.push_back(part);
+		}
+		return chip;
+	}
+};
+
+// the memory chips of projects 03 and 05 that run as C++ unless the top chip's directory has their .hdl
+struct MemoryChip {
+	const char* name;
+	int addressbits;
+	bool writable;
+};
+const MemoryChip MEMORY_CHIPS[] = {
+	{ "RAM16K", 14, true },
+	{ "Screen", 13, true },
+	{ "Keyboard", 0, false },
+	{ "ROM32K", 15, false },
+};
+
+// finds a chip by name: the top chip's directory first, then the built-in chips, then the
+// directories of projects 01 to 05. ARegister and DRegister are Registers
+class ChipLibrary {
+private:
+	vector<fs::path> dirs;
+	map<string, Chip> chips;
+public:
+	explicit ChipLibrary(const string& top) {
+		fs::path dir = fs::absolute(top).parent_path();
+		dirs.push_back(dir);
+		for (fs::path p = dir; ; p = p.parent_path()) {
+			if (fs::exists(p / "01" / "Not.hdl")) {
+				for (auto sub : { "01", "02", "03/a", "03/b", "05" })
+					if (fs::exists(p / sub) && !fs::equivalent(p / sub, dir)) dirs.push_back(p / sub);
+				break;
+			}
+			if (p == p.parent_path()) break;
+		}
+	}
+	static const MemoryChip* Memory(const string& name) {
+		for (auto& m : MEMORY_CHIPS)
+			if (name == m.name) return &m;
+		return nullptr;
+	}
+	const Chip& Find(const string& name) {
+		auto it = chips.find(name);
+		if (it != chips.end()) return it->second;
+		Chip chip;
+		chip.name = name;
+		const MemoryChip* memory = Memory(name);
+		if (name == "Nand") {
+			chip.inputs = { { "a", 1 }, { "b", 1 } };
+			chip.outputs = { { "out", 1 } };
+		} else if (name == "DFF") {
+			chip.inputs = { { "in", 1 } };
+			chip.outputs = { { "out", 1 } };
+		} else if (memory && !fs::exists(dirs[0] / (name + ".hdl"))) {
+			if (memory->writable) chip.inputs = { { "in", 16 }, { "load", 1 } };
+			if (memory->addressbits) chip.inputs.push_back({ "address", memory->addressbits });
+			chip.outputs = { { "out", 16 } };
+		} else {
+			string file = name == "ARegister" || name == "DRegister" ? "Register" : name;
+			auto dir = find_if(dirs.begin(), dirs.end(), [&](const fs::path& d) { return fs::exists(d / (file + ".hdl")); });
+			if (dir == dirs.end()) throw runtime_error("no chip " + name);
+			chip = HdlParser().Parse((*dir / (file + ".hdl")).string());
+			if (chip.name != file) throw runtime_error(chip.file + ": the chip is named " + chip.name);
+			chip.name = name;
+		}
+		return chips[name] = chip;
+	}
+};
+
+// a chip flattened to Nands, DFFs and memories. Every bit is a net; net 0 is false and net 1 is true
+class Netlist {
+public:
+	struct Gate {
+		int a, b, out; // out = Nand(a, b)
+	};
+	struct Flop {
+		int in, out;
+	};
+	struct Memory {
+		string name;
+		int words;
+		vector<int> address, in, out; // in is empty for ROM32K and Keyboard
+		int load = 0;
+	};
+	struct Port {
+		string name;
+		vector<int> nets; // low bit first
+	};
+
+	string name;
+	int nets = 2;
+	vector<Gate> gates;          // in evaluation order
+	vector<Flop> flops;
+	vector<Memory> memories;
+	vector<pair<size_t, int> > reads; // (gate, memory): read the memory before that gate
+	vector<Port> inputs, outputs;
+	map<string, vector<int> > parts; // the out pin of the first part of each chip, for ARegister[] and PC[] in scripts
+	size_t flattened = 0;        // Nands before folding
+	int levels = 0;              // Nands on the longest combinational path
+
+	// fold: drop Nands with a constant output, double negations, copies of another Nand and
+	// Nands nothing reads
+	void Elaborate(const string& file, bool fold = true) {
+		ChipLibrary library(file);
+		alias.assign(nets, -1);
+		placeholder.assign(nets, 0);
+		const Chip& top = library.Find(HdlParser().Parse(file).name);
+		name = top.name;
+		vector<vector<int> > in;
+		for (auto& pin : top.inputs) {
+			inputs.push_back({ pin.name, {} });
+			for (int i = 0; i < pin.width; ++i) inputs.back().nets.push_back(NewNet(false));
+			in.push_back(inputs.back().nets);
+		}
+		vector<vector<int> > out = Instantiate(library, top, in, 0);
+		for (size_t i = 0; i < top.outputs.size(); ++i) outputs.push_back({ top.outputs[i].name, out[i] });
+
+		auto resolve = [&](int& net) { net = Resolve(net); };
+		for (auto& g : gates) resolve(g.a), resolve(g.b);
+		for (auto& f : flops) resolve(f.in);
+		for (auto& m : memories) {
+			for_each(m.address.begin(), m.address.end(), resolve);
+			for_each(m.in.begin(), m.in.end(), resolve);
+			resolve(m.load);
+		}
+		for (auto& p : outputs) for_each(p.nets.begin(), p.nets.end(), resolve);
+		for (auto& p : parts) for_each(p.second.begin(), p.second.end(), resolve);
+		alias.clear();
+		placeholder.clear();
+		flattened = gates.size();
+		Levelize(fold);
+	}
+	int Input(const string& pin) const {
+		for (size_t i = 0; i < inputs.size(); ++i)
+			if (inputs[i].name == pin) return (int)i;
+		return -1;
+	}
+	int Output(const string& pin) const {
+		for (size_t i = 0; i < outputs.size(); ++i)
+			if (outputs[i].name == pin) return (int)i;
+		return -1;
+	}
+	// FNV-1a over the wiring, so that --compiled only runs the netlist the code was made from
+	uint64_t Checksum() const {
+		uint64_t h = 14695981039346656037ULL;
+		auto add = [&](int x) { h = (h ^ (uint32_t)x) * 1099511628211ULL; };
+		add(nets);
+		for (auto& g : gates) add(g.a), add(g.b), add(g.out);
+		for (auto& f : flops) add(f.in), add(f.out);
+		for (auto& m : memories) {
+			add(m.words);
+			for (auto* bus : { &m.address, &m.in, &m.out })
+				for (int n : *bus) add(n);
+			add(m.load);
+		}
+		for (auto* ports : { &inputs, &outputs })
+			for (auto& p : *ports)
+				for (int n : p.nets) add(n);
+		for (auto& p : parts)
+			for (int n : p.second) add(n);
+		return h;
+	}
+
+	// one statement per Nand, in evaluation order. Gate outputs are locals; inputs, DFF outputs
+	// and memory outputs come from v, and what the DFFs, the memories and the output pins read
+	// goes back to v. A memory read calls back into the simulator. The DFFs are copied at the
+	// clock edges by CompiledTick and CompiledTock
+	void WriteCompiled(ostream& os, const string& filename) const {
+		vector<char> local(nets, 0), stored(nets, 0);
+		for (auto& g : gates) local[g.out] = 1;
+		auto ref = [&](int n) { return local[n] ? "n" + to_string(n) : "v[" + to_string(n) + "]"; };
+		auto store = [&](int n) {
+			if (local[n] && !stored[n]) os << "\tv[" << n << "] = n" << n << ";" << endl;
+			stored[n] = 1;
+		};
+
+		os << "// generated by HDLSim --aot from " << filename << ", " << gates.size() << " Nands, "
+			<< flops.size() << " DFFs, " << memories.size() << " memories" << endl
+			<< "const uint64_t COMPILED_CHECKSUM = " << Checksum() << "ULL;" << endl
+			<< endl
+			<< "template <class S>" << endl
+			<< "void CompiledEval(uint64_t* v, S&" << (reads.empty() ? "" : " sim") << ") {" << endl;
+		size_t r = 0;
+		for (size_t i = 0; i <= gates.size(); ++i) {
+			for (; r < reads.size() && reads[r].first == i; ++r) {
+				for (int n : memories[reads[r].second].address) store(n);
+				os << "\tsim.Read(" << reads[r].second << ");" << endl;
+			}
+			if (i == gates.size()) break;
+			os << "\tconst uint64_t n" << gates[i].out << " = ~(" << ref(gates[i].a) << " & " << ref(gates[i].b) << ");" << endl;
+		}
+		for (auto& f : flops) store(f.in);
+		for (auto& m : memories) {
+			for (int n : m.in) store(n);
+			store(m.load);
+		}
+		for (auto& p : outputs)
+			for (int n : p.nets) store(n);
+		for (auto& p : parts)
+			for (int n : p.second) store(n);
+		os << "}" << endl
+			<< endl
+			<< "inline void CompiledTick(const uint64_t* v, uint64_t* state) {" << endl;
+		for (size_t i = 0; i < flops.size(); ++i) os << "\tstate[" << i << "] = v[" << flops[i].in << "];" << endl;
+		os << "}" << endl
+			<< endl
+			<< "inline void CompiledTock(uint64_t* v, const uint64_t* state) {" << endl;
+		for (size_t i = 0; i < flops.size(); ++i) os << "\tv[" << flops[i].out << "] = state[" << i << "];" << endl;
+		os << "}" << endl;
+	}
+
+	int FindMemory(const string& chip) const {
+		for (size_t i = 0; i < memories.size(); ++i)
+			if (memories[i].name == chip) return (int)i;
+		return -1;
+	}
+private:
+	vector<int> alias;        // the net a wire or an output pin is connected to, -1 until a part drives it
+	vector<char> placeholder; // wires and output pins, which only alias other nets
+
+	int NewNet(bool wire) {
+		alias.push_back(-1);
+		placeholder.push_back(wire);
+		return nets++;
+	}
+	void NewNets(vector<int>& nets, int width, bool wire) {
+		for (int i = 0; i < width; ++i) nets.push_back(NewNet(wire));
+	}
+	// a wire nothing drives, like an unconnected output pin, is false
+	int Resolve(int net) const {
+		while (alias[net] >= 0) net = alias[net];
+		return placeholder[net] ? 0 : net;
+	}
+
+	static int Find(const vector<Pin>& pins, const string& name) {
+		for (size_t i = 0; i < pins.size(); ++i)
+			if (pins[i].name == name) return (int)i;
+		return -1;
+	}
+
+	// the nets of a chip's outputs, given the nets of its inputs
+	vector<vector<int> > Instantiate(ChipLibrary& library, const Chip& chip, const vector<vector<int> >& in, int depth) {
+		if (depth > 64) throw runtime_error(chip.name + " contains itself");
+		vector<vector<int> > out(chip.outputs.size());
+		if (chip.name == "Nand") {
+			out[0].push_back(NewNet(false));
+			gates.push_back({ in[0][0], in[1][0], out[0][0] });
+			return out;
+		}
+		if (chip.name == "DFF") {
+			out[0].push_back(NewNet(false));
+			flops.push_back({ in[0][0], out[0][0] });
+			return out;
+		}
+		if (chip.parts.empty() && ChipLibrary::Memory(chip.name)) {
+			const MemoryChip& m = *ChipLibrary::Memory(chip.name);
+			Memory memory;
+			memory.name = chip.name;
+			memory.words = 1 << m.addressbits;
+			if (m.writable) {
+				memory.in = in[0];
+				memory.load = in[1][0];
+			}
+			if (m.addressbits) memory.address = in.back();
+			NewNets(memory.out, 16, false);
+			memories.push_back(memory);
+			out[0] = memory.out;
+			return out;
+		}
+
+		map<string, vector<int> > wires;
+		for (size_t i = 0; i < chip.inputs.size(); ++i) wires[chip.inputs[i].name] = in[i];
+		for (size_t i = 0; i < chip.outputs.size(); ++i) {
+			NewNets(out[i], chip.outputs[i].width, true);
+			wires[chip.outputs[i].name] = out[i];
+		}
+
+		auto error = [&](const Part& part, const string& message) {
+			return runtime_error(chip.file + ":" + to_string(part.line) + ": " + message);
+		};
+		// the bits of a bus a sub-bus names
+		auto slice = [&](const Part& part, const vector<int>& bits, const Bus& bus) {
+			if (bus.lo < 0) return bits;
+			if (bus.hi >= (int)bits.size()) throw error(part, bus.name + "[" + to_string(bus.hi) + "] is out of range");
+			return vector<int>(bits.begin() + bus.lo, bits.begin() + bus.hi + 1);
+		};
+
+		// a part output pin connected to an unknown name makes a new wire
+		for (auto& part : chip.parts) {
+			const Chip& def = library.Find(part.chip);
+			for (auto& c : part.connections) {
+				int pin = Find(def.outputs, c.first.name);
+				if (pin < 0 || wires.count(c.second.name)) continue;
+				if (c.second.name == "true" || c.second.name == "false") throw error(part, "an output drives " + c.second.name);
+				if (c.second.lo >= 0) throw error(part, "sub-bus of the internal wire " + c.second.name);
+				int width = c.first.lo < 0 ? def.outputs[pin].width : c.first.hi - c.first.lo + 1;
+				NewNets(wires[c.second.name], width, true);
+			}
+		}
+
+		for (auto& part : chip.parts) {
+			const Chip& def = library.Find(part.chip);
+			vector<vector<int> > pins(def.inputs.size());
+			for (size_t i = 0; i < def.inputs.size(); ++i) pins[i].assign(def.inputs[i].width, 0);
+			for (auto& c : part.connections) {
+				int pin = Find(def.inputs, c.first.name);
+				if (pin < 0) {
+					if (Find(def.outputs, c.first.name) < 0) throw error(part, part.chip + " has no pin " + c.first.name);
+					continue;
+				}
+				vector<int> target(def.inputs[pin].width);
+				for (int i = 0; i < def.inputs[pin].width; ++i) target[i] = i;
+				target = slice(part, target, c.first);
+				vector<int> source;
+				if (c.second.name == "true" || c.second.name == "false") source.assign(target.size(), c.second.name == "true");
+				else {
+					auto it = wires.find(c.second.name);
+					if (it == wires.end()) throw error(part, "no wire " + c.second.name);
+					source = slice(part, it->second, c.second);
+				}
+				if (source.size() != target.size()) throw error(part, c.first.name + " is " + to_string(target.size()) + " bits wide but " + c.second.name + " is " + to_string(source.size()));
+				for (size_t i = 0; i < target.size(); ++i) pins[pin][target[i]] = source[i];
+			}
+
+			vector<vector<int> > outs = Instantiate(library, def, pins, depth + 1);
+			int o = Find(def.outputs, "out");
+			if (o >= 0) parts.insert({ def.name, outs[o] });
+			for (auto& c : part.connections) {
+				int pin = Find(def.outputs, c.first.name);
+				if (pin < 0) continue;
+				vector<int> source = slice(part, outs[pin], c.first);
+				vector<int> target = slice(part, wires[c.second.name], c.second);
+				if (source.size() != target.size()) throw error(part, c.first.name + " is " + to_string(source.size()) + " bits wide but " + c.second.name + " is " + to_string(target.size()));
+				for (size_t i = 0; i < target.size(); ++i) {
+					if (!placeholder[target[i]]) throw error(part, c.second.name + " is an input pin");
+					if (alias[target[i]] >= 0) throw error(part, c.second.name + " has more than one source");
+					alias[target[i]] = source[i];
+				}
+			}
+		}
+		return out;
+	}
+
+	// orders the Nands and the memory reads so that every one comes after what it reads.
+	// A memory's outputs depend on its address only; what it stores changes at the clock
+	void Levelize(bool fold) {
+		size_t count = gates.size() + memories.size(); // gates, then memory reads
+		vector<char> ready(nets, 0);
+		ready[0] = ready[1] = 1;
+		for (auto& p : inputs) for (int n : p.nets) ready[n] = 1;
+		for (auto& f : flops) ready[f.out] = 1;
+		vector<vector<int> > readers(nets);
+		vector<int> pending(count, 0);
+		auto wait = [&](int node, int net) {
+			if (!ready[net]) {
+				readers[net].push_back(node);
+				++pending[node];
+			}
+		};
+		for (size_t i = 0; i < gates.size(); ++i) wait((int)i, gates[i].a), wait((int)i, gates[i].b);
+		for (size_t i = 0; i < memories.size(); ++i)
+			for (int n : memories[i].address) wait((int)(gates.size() + i), n);
+
+		vector<int> order;
+		for (size_t i = 0; i < count; ++i)
+			if (!pending[i]) order.push_back((int)i);
+		for (size_t next = 0; next < order.size(); ++next) {
+			int node = order[next];
+			auto done = [&](int net) {
+				for (int reader : readers[net])
+					if (--pending[reader] == 0) order.push_back(reader);
+			};
+			if (node < (int)gates.size()) done(gates[node].out);
+			else for (int n : memories[node - gates.size()].out) done(n);
+		}
+		if (order.size() < count) throw runtime_error(name + " has a combinational loop through " + to_string(count - order.size()) + " Nands and memories");
+
+		// constants, double negations and copies, in evaluation order
+		vector<int> replace(nets);
+		for (int i = 0; i < nets; ++i) replace[i] = i;
+		vector<int> inverse(nets, -1); // the net a Nand negates
+		unordered_map<uint64_t, int> seen; // the Nand of two nets
+		vector<Gate> kept;
+		vector<int> position(count, -1);
+		for (int node : order) {
+			if (node >= (int)gates.size()) {
+				Memory& m = memories[node - gates.size()];
+				for (int& n : m.address) n = replace[n];
+				position[node] = (int)kept.size();
+				continue;
+			}
+			Gate g = gates[node];
+			g.a = replace[g.a];
+			g.b = replace[g.b];
+			if (fold) {
+				if (g.a == 1) swap(g.a, g.b);
+				if (g.a == 0 || g.b == 0) {
+					replace[g.out] = 1;
+					continue;
+				}
+				if (g.a == 1) {
+					replace[g.out] = 0;
+					continue;
+				}
+				if (g.b == 1) g.b = g.a;
+				if (g.a > g.b) swap(g.a, g.b);
+				if (g.a == g.b && inverse[g.a] >= 0) {
+					replace[g.out] = inverse[g.a];
+					continue;
+				}
+				auto same = seen.insert({ (uint64_t)g.a << 32 | (uint32_t)g.b, g.out });
+				if (!same.second) {
+					replace[g.out] = same.first->second;
+					continue;
+				}
+				if (g.a == g.b) inverse[g.out] = g.a;
+			}
+			kept.push_back(g);
+		}
+		for (auto& f : flops) f.in = replace[f.in];
+		for (auto& m : memories) {
+			for (int& n : m.in) n = replace[n];
+			m.load = replace[m.load];
+		}
+		for (auto& p : outputs) for (int& n : p.nets) n = replace[n];
+		for (auto& p : parts) for (int& n : p.second) n = replace[n];
+
+		// what the outputs, the flops and the memories read, walking back
+		vector<char> live(fold ? nets : 0, 0);
+		for (auto& p : outputs) for (int n : p.nets) if (fold) live[n] = 1;
+		for (auto& p : parts) for (int n : p.second) if (fold) live[n] = 1;
+		for (auto& f : flops) if (fold) live[f.in] = 1;
+		for (auto& m : memories)
+			if (fold) {
+				for (int n : m.address) live[n] = 1;
+				for (int n : m.in) live[n] = 1;
+				live[m.load] = 1;
+			}
+		vector<char> keep(kept.size(), 1);
+		if (fold)
+			for (size_t i = kept.size(); i-- > 0;) {
+				if (!live[kept[i].out]) keep[i] = 0;
+				else live[kept[i].a] = live[kept[i].b] = 1;
+			}
+
+		gates.clear();
+		reads.clear();
+		vector<int> level(nets, 0);
+		levels = 0;
+		size_t k = 0;
+		for (int node : order) {
+			if (node < (int)flattened) continue;
+			// a memory read goes before the first gate that came after it
+			for (; k < (size_t)position[node]; ++k)
+				if (keep[k]) Emit(kept[k], level);
+			int m = node - (int)flattened;
+			reads.push_back({ gates.size(), m });
+			int l = 0;
+			for (int n : memories[m].address) l = max(l, level[n]);
+			for (int n : memories[m].out) level[n] = l;
+		}
+		for (; k < kept.size(); ++k)
+			if (keep[k]) Emit(kept[k], level);
+	}
+	void Emit(const Gate& g, vector<int>& level) {
+		level[g.out] = max(level[g.a], level[g.b]) + 1;
+		levels = max(levels, level[g.out]);
+		gates.push_back(g);
+	}
+};
+
+// 256 vectors a step. With AVX2 a Nand is one vector instruction
+struct alignas(32) Wide {
+	uint64_t w[4];
+};
+
+inline uint64_t Nand(uint64_t x, uint64_t y) {
+	return ~(x & y);
+}
+
+inline Wide Nand(const Wide& x, const Wide& y) {
+	Wide r;
+#ifdef __AVX2__
+	__m256i a = _mm256_load_si256((const __m256i*)x.w);
+	__m256i b = _mm256_load_si256((const __m256i*)y.w);
+	_mm256_store_si256((__m256i*)r.w, _mm256_xor_si256(_mm256_and_si256(a, b), _mm256_set1_epi64x(-1)));
+#else
+	for (int i = 0; i < 4; ++i) r.w[i] = ~(x.w[i] & y.w[i]);
+#endif
+	return r;
+}
+
+inline uint64_t* Words(uint64_t& x) { return &x; }
+inline const uint64_t* Words(const uint64_t& x) { return &x; }
+inline uint64_t* Words(Wide& x) { return x.w; }
+inline const uint64_t* Words(const Wide& x) { return x.w; }
+
+// runs a netlist on one vector per bit of W (lane). Each lane has its own memories,
+// but only the first `lanes` are read and written
+template <class W>
+class Simulator {
+public:
+	static const int LANES = sizeof(W) * 8;
+private:
+	const Netlist& netlist;
+	vector<W> value; // per net
+	vector<W> state; // per flop, from tick to tock
+	vector<vector<uint16_t> > memory; // per memory, lane after lane
+	struct Write {
+		int memory, lane, address;
+		uint16_t value;
+	};
+	vector<Write> writes; // from tick to tock
+	int lanes;
+	bool compiled = false;
+
+	static bool Bit(const W& x, int lane) {
+		return Words(x)[lane >> 6] >> (lane & 63) & 1;
+	}
+	static void SetBit(W& x, int lane, bool bit) {
+		uint64_t& w = Words(x)[lane >> 6];
+		w = (w & ~(1ULL << (lane & 63))) | (uint64_t)bit << (lane & 63);
+	}
+	uint16_t Address(const Netlist::Memory& m, int lane) const {
+		uint16_t address = 0;
+		for (size_t b = 0; b < m.address.size(); ++b) address |= Bit(value[m.address[b]], lane) << b;
+		return address;
+	}
+	// the DFFs and the memories take their inputs
+	void Sample() {
+#ifdef HDLSIM_AOT
+		if constexpr (is_same<W, uint64_t>::value)
+			if (compiled) CompiledTick(value.data(), state.data());
+#endif
+		if (!compiled) for (size_t i = 0; i < state.size(); ++i) state[i] = value[netlist.flops[i].in];
+		for (size_t i = 0; i < netlist.memories.size(); ++i) {
+			const Netlist::Memory& m = netlist.memories[i];
+			if (m.in.empty()) continue;
+			for (int lane = 0; lane < lanes; ++lane) {
+				if (!Bit(value[m.load], lane)) continue;
+				uint16_t word = 0;
+				for (int b = 0; b < 16; ++b) word |= Bit(value[m.in[b]], lane) << b;
+				writes.push_back({ (int)i, lane, Address(m, lane), word });
+			}
+		}
+	}
+	// and their outputs change
+	void Commit() {
+#ifdef HDLSIM_AOT
+		if constexpr (is_same<W, uint64_t>::value)
+			if (compiled) CompiledTock(value.data(), state.data());
+#endif
+		if (!compiled) for (size_t i = 0; i < state.size(); ++i) value[netlist.flops[i].out] = state[i];
+		for (auto& w : writes) Memory(w.memory, w.lane)[w.address] = w.value;
+		writes.clear();
+	}
+public:
+	explicit Simulator(const Netlist& netlist, int lanes = LANES) : netlist(netlist), value(netlist.nets), state(netlist.flops.size()), lanes(lanes) {
+		for (int i = 0; i < LANES; ++i) SetBit(value[1], i, 1);
+		for (auto& m : netlist.memories) memory.emplace_back((size_t)m.words * lanes, 0);
+	}
+	void Set(int input, int lane, int v) {
+		auto& nets = netlist.inputs[input].nets;
+		for (size_t b = 0; b < nets.size(); ++b) SetBit(value[nets[b]], lane, v >> b & 1);
+	}
+	// all lanes at once, bit b of lanes[i] is bit i of lane b
+	void SetBits(int input, const W* bits) {
+		auto& nets = netlist.inputs[input].nets;
+		for (size_t b = 0; b < nets.size(); ++b) value[nets[b]] = bits[b];
+	}
+	const W& Value(int net) const {
+		return value[net];
+	}
+	// what a DFF took at the last tick, its output after the next tock
+	const W& Latched(int flop) const {
+		return state[flop];
+	}
+	int Get(int output, int lane) const {
+		auto& nets = netlist.outputs[output].nets;
+		int v = 0;
+		for (size_t b = 0; b < nets.size(); ++b) v |= Bit(value[nets[b]], lane) << b;
+		return v;
+	}
+	// Eval, Tick and Tock run the code from --aot. Only for 64 lanes, and only in a build with it
+	void UseCompiled() {
+#ifdef HDLSIM_AOT
+		compiled = is_same<W, uint64_t>::value;
+#endif
+	}
+	// the outputs of a memory for the address on its inputs; also called by compiled code
+	void Read(int index) {
+		const Netlist::Memory& m = netlist.memories[index];
+		const uint16_t* words = memory[index].data();
+		for (int lane = 0; lane < lanes; ++lane) {
+			uint16_t word = words[lane * m.words + Address(m, lane)];
+			for (int b = 0; b < 16; ++b) SetBit(value[m.out[b]], lane, word >> b & 1);
+		}
+	}
+	uint16_t* Memory(int index, int lane = 0) {
+		return memory[index].data() + (size_t)lane * netlist.memories[index].words;
+	}
+
+	void Eval() {
+#ifdef HDLSIM_AOT
+		if constexpr (is_same<W, uint64_t>::value)
+			if (compiled) {
+				CompiledEval(value.data(), *this);
+				return;
+			}
+#endif
+		const Netlist::Gate* g = netlist.gates.data();
+		W* v = value.data();
+		size_t i = 0;
+		for (auto& r : netlist.reads) {
+			for (; i < r.first; ++i) v[g[i].out] = Nand(v[g[i].a], v[g[i].b]);
+			Read(r.second);
+		}
+		for (size_t n = netlist.gates.size(); i < n; ++i) v[g[i].out] = Nand(v[g[i].a], v[g[i].b]);
+	}
+	// the clock goes up: the DFFs and the memories take their inputs. Their outputs change at tock
+	void Tick() {
+		Eval();
+		Sample();
+	}
+	void Tock() {
+		Commit();
+		Eval();
+	}
+	// tick and tock with inputs that have not changed since the last Eval
+	void Cycle() {
+		Sample();
+		Commit();
+		Eval();
+	}
+};
+
+// what the chips of projects 01 and 02 compute, with their pins in the book's order
+struct Model {
+	vector<string> inputs, outputs;
+	void (*f)(const uint32_t* in, uint32_t* out);
+};
+
+const map<string, Model>& Models() {
+	static const map<string, Model> models = {
+		{ "Nand", { { "a", "b" }, { "out" }, [](const uint32_t* i, uint32_t* o) { o[0] = !(i[0] & i[1]); } } },
+		{ "Not", { { "in" }, { "out" }, [](const uint32_t* i, uint32_t* o) { o[0] = !i[0]; } } },
+		{ "And", { { "a", "b" }, { "out" }, [](const uint32_t* i, uint32_t* o) { o[0] = i[0] & i[1]; } } },
+		{ "Or", { { "a", "b" }, { "out" }, [](const uint32_t* i, uint32_t* o) { o[0] = i[0] | i[1]; } } },
+		{ "Xor", { { "a", "b" }, { "out" }, [](const uint32_t* i, uint32_t* o) { o[0] = i[0] ^ i[1]; } } },
+		{ "Mux", { { "a", "b", "sel" }, { "out" }, [](const uint32_t* i, uint32_t* o) { o[0] = i[2] ? i[1] : i[0]; } } },
+		{ "DMux", { { "in", "sel" }, { "a", "b" }, [](const uint32_t* i, uint32_t* o) { o[0] = i[1] ? 0 : i[0]; o[1] = i[1] ? i[0] : 0; } } },
+		{ "Not16", { { "in" }, { "out" }, [](const uint32_t* i, uint32_t* o) { o[0] = ~i[0] & 0xFFFF; } } },
+		{ "And16", { { "a", "b" }, { "out" }, [](const uint32_t* i, uint32_t* o) { o[0] = i[0] & i[1]; } } },
+		{ "Or16", { { "a", "b" }, { "out" }, [](const uint32_t* i, uint32_t* o) { o[0] = i[0] | i[1]; } } },
+		{ "Mux16", { { "a", "b", "sel" }, { "out" }, [](const uint32_t* i, uint32_t* o) { o[0] = i[2] ? i[1] : i[0]; } } },
+		{ "Or8Way", { { "in" }, { "out" }, [](const uint32_t* i, uint32_t* o) { o[0] = i[0] != 0; } } },
+		{ "Mux4Way16", { { "a", "b", "c", "d", "sel" }, { "out" }, [](const uint32_t* i, uint32_t* o) { o[0] = i[i[4]]; } } },
+		{ "Mux8Way16", { { "a", "b", "c", "d", "e", "f", "g", "h", "sel" }, { "out" }, [](const uint32_t* i, uint32_t* o) { o[0] = i[i[8]]; } } },
+		{ "DMux4Way", { { "in", "sel" }, { "a", "b", "c", "d" }, [](const uint32_t* i, uint32_t* o) { for (uint32_t k = 0; k < 4; ++k) o[k] = k == i[1] ? i[0] : 0; } } },
+		{ "DMux8Way", { { "in", "sel" }, { "a", "b", "c", "d", "e", "f", "g", "h" }, [](const uint32_t* i, uint32_t* o) { for (uint32_t k = 0; k < 8; ++k) o[k] = k == i[1] ? i[0] : 0; } } },
+		{ "HalfAdder", { { "a", "b" }, { "sum", "carry" }, [](const uint32_t* i, uint32_t* o) { o[0] = i[0] ^ i[1]; o[1] = i[0] & i[1]; } } },
+		{ "FullAdder", { { "a", "b", "c" }, { "sum", "carry" }, [](const uint32_t* i, uint32_t* o) { uint32_t s = i[0] + i[1] + i[2]; o[0] = s & 1; o[1] = s >> 1; } } },
+		{ "Add16", { { "a", "b" }, { "out" }, [](const uint32_t* i, uint32_t* o) { o[0] = (i[0] + i[1]) & 0xFFFF; } } },
+		{ "Inc16", { { "in" }, { "out" }, [](const uint32_t* i, uint32_t* o) { o[0] = (i[0] + 1) & 0xFFFF; } } },
+		{ "ALU", { { "x", "y", "zx", "nx", "zy", "ny", "f", "no" }, { "out", "zr", "ng" }, [](const uint32_t* i, uint32_t* o) {
+			uint32_t x = i[2] ? 0 : i[0], y = i[4] ? 0 : i[1];
+			if (i[3]) x = ~x & 0xFFFF;
+			if (i[5]) y = ~y & 0xFFFF;
+			uint32_t out = (i[6] ? x + y : x & y) & 0xFFFF;
+			if (i[7]) out = ~out & 0xFFFF;
+			o[0] = out;
+			o[1] = out == 0;
+			o[2] = out >> 15;
+		} } },
+	};
+	return models;
+}
+
+// a[i] bit k trades places with a[k] bit i
+inline void Transpose64(uint64_t a[64]) {
+	uint64_t m = 0x00000000FFFFFFFFULL;
+	for (int j = 32; j; j >>= 1, m ^= m << j)
+		for (int k = 0; k < 64; k = ((k | j) + 1) & ~j) {
+			uint64_t t = ((a[k] >> j) ^ a[k | j]) & m;
+			a[k] ^= t << j;
+			a[k | j] ^= t;
+		}
+}
+
+// compares a combinational chip with its model: every input vector when the inputs have
+// at most 24 bits, else `random` vectors. The inputs go in as bit planes (lane i of plane b
+// is bit b of the inputs of vector i) and come back out a vector at a time by transposing
+// 64 x 64 blocks. Returns the mismatches and prints the first few; `simulation` is the time
+// spent in Simulator::Eval
+template <class W>
+long long Verify(const Netlist& netlist, const Model& model, long long random, bool compiled, long long& vectors, double& simulation) {
+	const int LANES = Simulator<W>::LANES, WORDS = LANES / 64;
+	size_t ni = netlist.inputs.size(), no = netlist.outputs.size();
+	vector<int> inoffset, outoffset;
+	int inbits = 0, outbits = 0;
+	for (auto& p : netlist.inputs) inoffset.push_back(inbits), inbits += (int)p.nets.size();
+	for (auto& p : netlist.outputs) outoffset.push_back(outbits), outbits += (int)p.nets.size();
+	int inblocks = (inbits + 63) / 64, outblocks = (outbits + 63) / 64;
+	bool exhaustive = inbits <= 24;
+	vectors = exhaustive ? 1LL << inbits : random;
+
+	Simulator<W> sim(netlist, 0);
+	if (compiled) sim.UseCompiled();
+	vector<W> planes(inblocks * 64);
+	vector<uint64_t> ins(64 * inblocks), outs(64 * outblocks), block(64);
+	vector<uint32_t> in(ni), out(no), expected(no);
+	uint64_t seed = 0x9E3779B97F4A7C15ULL;
+	auto next = [&]() {
+		// splitmix64
+		uint64_t z = (seed += 0x9E3779B97F4A7C15ULL);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+		return z ^ (z >> 31);
+	};
+	const uint64_t PATTERN[6] = {
+		0xAAAAAAAAAAAAAAAAULL, 0xCCCCCCCCCCCCCCCCULL, 0xF0F0F0F0F0F0F0F0ULL,
+		0xFF00FF00FF00FF00ULL, 0xFFFF0000FFFF0000ULL, 0xFFFFFFFF00000000ULL
+	};
+	// bits [offset, offset + width) of a vector split over 64-bit words
+	auto field = [](const uint64_t* words, int offset, int width) {
+		uint64_t v = words[offset >> 6] >> (offset & 63);
+		if ((offset & 63) + width > 64) v |= words[(offset >> 6) + 1] << (64 - (offset & 63));
+		return (uint32_t)(v & ((1u << width) - 1));
+	};
+
+	long long mismatches = 0;
+	for (long long base = 0; base < vectors; base += LANES) {
+		for (int b = 0; b < inbits; ++b)
+			for (int w = 0; w < WORDS; ++w) {
+				long long first = base + 64 * w; // the vector in lane 0 of this word
+				Words(planes[b])[w] = !exhaustive ? next() : b < 6 ? PATTERN[b] : first >> b & 1 ? ~0ULL : 0;
+			}
+		for (size_t p = 0; p < ni; ++p) sim.SetBits((int)p, &planes[inoffset[p]]);
+		auto start = chrono::steady_clock::now();
+		sim.Eval();
+		simulation += chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+		for (int w = 0; w < WORDS && base + 64 * w < vectors; ++w) {
+			for (int c = 0; c < inblocks; ++c) {
+				for (int r = 0; r < 64; ++r) block[r] = c * 64 + r < inbits ? Words(planes[c * 64 + r])[w] : 0;
+				Transpose64(block.data());
+				for (int lane = 0; lane < 64; ++lane) ins[lane * inblocks + c] = block[lane];
+			}
+			for (int c = 0; c < outblocks; ++c) {
+				for (int r = 0; r < 64; ++r) block[r] = 0;
+				for (size_t p = 0, r = 0; p < no; ++p)
+					for (int net : netlist.outputs[p].nets) {
+						if (r >= (size_t)c * 64 && r < (size_t)c * 64 + 64) block[r - c * 64] = Words(sim.Value(net))[w];
+						++r;
+					}
+				Transpose64(block.data());
+				for (int lane = 0; lane < 64; ++lane) outs[lane * outblocks + c] = block[lane];
+			}
+			int n = (int)min<long long>(64, vectors - base - 64 * w);
+			for (int lane = 0; lane < n; ++lane) {
+				for (size_t p = 0; p < ni; ++p) in[p] = field(&ins[lane * inblocks], inoffset[p], (int)netlist.inputs[p].nets.size());
+				model.f(in.data(), expected.data());
+				bool same = true;
+				for (size_t p = 0; p < no; ++p) {
+					out[p] = field(&outs[lane * outblocks], outoffset[p], (int)netlist.outputs[p].nets.size());
+					same = same && out[p] == expected[p];
+				}
+				if (same || ++mismatches > 5) continue;
+				cout << "mismatch:";
+				for (size_t p = 0; p < ni; ++p) cout << ' ' << netlist.inputs[p].name << '=' << in[p];
+				cout << " ->";
+				for (size_t p = 0; p < no; ++p) cout << ' ' << netlist.outputs[p].name << '=' << out[p] << " (" << expected[p] << ')';
+				cout << endl;
+			}
+		}
+	}
+	return mismatches;
+}
+
+#ifndef NO_MAIN
+// RAM16K, Screen and Keyboard as the CPU addresses them
+uint16_t* Ram(const Netlist& netlist, Simulator<uint64_t>& sim, int address) {
+	int ram = netlist.FindMemory("RAM16K"), screen = netlist.FindMemory("Screen"), keyboard = netlist.FindMemory("Keyboard");
+	if (address < 16384 && ram >= 0) return sim.Memory(ram) + address;
+	if (address >= 16384 && address < 24576 && screen >= 0) return sim.Memory(screen) + address - 16384;
+	if (address == 24576 && keyboard >= 0) return sim.Memory(keyboard);
+	throw runtime_error("no memory at " + to_string(address));
+}
+
+int main(int argc, char** argv) {
+	string filename, aotfile, romfile;
+	bool verify = false, wide = false, fold = true, compiled = false;
+	long long random = 1 << 20, cycles = -1;
+	vector<pair<int, int> > sets, prints;
+	for (int i = 1; i < argc; ++i) {
+		string arg = argv[i];
+		if (arg == "--verify") verify = true;
+		else if (arg == "--vectors" && i + 1 < argc) random = stoll(argv[++i]);
+		else if (arg == "--wide") wide = true;
+		else if (arg == "--no-fold") fold = false;
+		else if (arg == "--aot" && i + 1 < argc) aotfile = argv[++i];
+		else if (arg == "--compiled") compiled = true;
+		else if (arg == "--rom" && i + 1 < argc) romfile = argv[++i];
+		else if (arg == "--cycles" && i + 1 < argc) cycles = stoll(argv[++i]);
+		else if (arg == "--ram" && i + 1 < argc) {
+			// address=value
+			string s = argv[++i];
+			size_t eq = s.find('=');
+			sets.push_back({ stoi(s.substr(0, eq)), stoi(s.substr(eq + 1)) });
+		} else if (arg == "--print" && i + 1 < argc) {
+			// address or first-last
+			string s = argv[++i];
+			size_t dash = s.find('-');
+			int first = stoi(s.substr(0, dash));
+			prints.push_back({ first, dash == string::npos ? first : stoi(s.substr(dash + 1)) });
+		} else filename = arg;
+	}
+	if (filename.empty()) {
+		cerr << "usage: HDLSim [--verify] [--vectors n] [--wide] [--no-fold] [--aot out.inc] [--compiled] [--cycles n] [--rom program.hack] [--ram addr=value] [--print addr[-addr]] <chip.hdl>" << endl;
+		return 1;
+	}
+
+	try {
+		Netlist netlist;
+		auto start = chrono::steady_clock::now();
+		netlist.Elaborate(filename, fold);
+		double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+		int inbits = 0, outbits = 0;
+		for (auto& p : netlist.inputs) inbits += (int)p.nets.size();
+		for (auto& p : netlist.outputs) outbits += (int)p.nets.size();
+		cout << netlist.name << ": " << netlist.gates.size() << " Nands (" << netlist.flattened << " before folding), "
+			<< netlist.flops.size() << " DFFs, " << netlist.memories.size() << " memories, "
+			<< inbits << " input bits, " << outbits << " output bits, " << netlist.levels << " levels" << endl;
+		cout << fixed << setprecision(2) << "elaborated in " << ms << " ms" << endl;
+
+		if (!aotfile.empty()) {
+			ofstream ofs(aotfile);
+			netlist.WriteCompiled(ofs, fs::path(filename).filename().string());
+			return 0;
+		}
+#ifdef HDLSIM_AOT
+		if (compiled && netlist.Checksum() != COMPILED_CHECKSUM) throw runtime_error(filename + " is not the chip " + HDLSIM_AOT + " was made from");
+		if (compiled && wide) throw runtime_error("--compiled runs 64 lanes, not --wide");
+#else
+		if (compiled) throw runtime_error("--compiled needs a build with -DHDLSIM_AOT='\"<file from --aot>\"'");
+#endif
+
+		if (cycles >= 0) {
+			// one lane: the chip as a computer
+			Simulator<uint64_t> sim(netlist, 1);
+			if (compiled) sim.UseCompiled();
+			if (!romfile.empty()) {
+				int rom = netlist.FindMemory("ROM32K");
+				ifstream ifs(romfile);
+				if (rom < 0 || !ifs) throw runtime_error("cannot load " + romfile + " into ROM32K");
+				string line;
+				for (int address = 0; getline(ifs, line) && address < 32768; ++address)
+					sim.Memory(rom)[address] = (uint16_t)stoul(line, nullptr, 2);
+			}
+			for (auto& [address, value] : sets) *Ram(netlist, sim, address) = value;
+			start = chrono::steady_clock::now();
+			sim.Eval();
+			for (long long n = 0; n < cycles; ++n) sim.Cycle();
+			ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+			cout << cycles << " cycles, " << ms << " ms, " << cycles / ms / 1000 << " MHz" << (compiled ? " (compiled)" : "") << endl;
+			for (auto& [first, last] : prints)
+				for (int address = first; address <= last; ++address)
+					cout << "RAM[" << address << "] = " << (int16_t)*Ram(netlist, sim, address) << endl;
+			return 0;
+		}
+		if (!verify) return 0;
+
+		auto model = Models().find(netlist.name);
+		if (model == Models().end()) throw runtime_error("no model of " + netlist.name);
+		vector<string> ins, outs;
+		for (auto& p : netlist.inputs) ins.push_back(p.name);
+		for (auto& p : netlist.outputs) outs.push_back(p.name);
+		if (ins != model->second.inputs || outs != model->second.outputs || !netlist.flops.empty() || !netlist.memories.empty())
+			throw runtime_error(netlist.name + " does not have the pins of its model");
+
+		long long vectors = 0;
+		double simulation = 0;
+		start = chrono::steady_clock::now();
+		long long mismatches = wide ? Verify<Wide>(netlist, model->second, random, false, vectors, simulation)
+			: Verify<uint64_t>(netlist, model->second, random, compiled, vectors, simulation);
+		ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+		cout << vectors << (inbits <= 24 ? " vectors (all of them)" : " random vectors") << ", "
+			<< (wide ? Simulator<Wide>::LANES : Simulator<uint64_t>::LANES) << " lanes, " << ms << " ms (" << simulation << " ms simulating), "
+			<< mismatches << " mismatches" << endl;
+		return mismatches ? 2 : 0;
+	} catch (const exception& e) {
+		cerr << "HDLSim: " << e.what() << endl;
+		return 1;
+	}
+}
+#endif
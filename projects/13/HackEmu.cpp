@@ -0,0 +1,1340 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <iomanip>
+#include <chrono>
+#include <cstdint>
+#include <climits>
+#include <set>
+#include <map>
+#include <sstream>
+#include <algorithm>
+#include <array>
+#include <memory>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+// what a predecoded instruction does. AT loads A, HALT is "(L) @L 0;JMP", END is past the program.
+// The C-instructions translated code runs most get an op of their own (D_IS_M is "D=M"),
+// the rest are named by their comp field and store through the dest and jump bits.
+// ALU is any comp outside the book's table. The last row are sequences VMtranslator writes
+// again and again, fused into one instruction (Hack::Fuse)
+enum Op : uint8_t {
+	AT, HALT, END,
+	D_IS_M, M_IS_D, D_IS_A, A_IS_M, A_IS_M_MINUS_1, A_IS_A_PLUS_1, A_IS_A_MINUS_1, A_IS_D_PLUS_A,
+	AM_IS_M_PLUS_1, AM_IS_M_MINUS_1, M_IS_M_PLUS_1, M_IS_0, M_IS_MINUS_1, M_IS_NOT_M, M_IS_D_PLUS_M, D_IS_M_MINUS_D,
+	JMP, D_JGT, D_JEQ, D_JGE, D_JLT, D_JNE, D_JLE,
+	ALU,
+	ZERO, ONE, MINUS_ONE, D, A, NOT_D, NOT_A, NEG_D, NEG_A,
+	D_PLUS_1, A_PLUS_1, D_MINUS_1, A_MINUS_1, D_PLUS_A, D_MINUS_A, A_MINUS_D, D_AND_A, D_OR_A,
+	M, NOT_M, NEG_M, M_PLUS_1, M_MINUS_1, D_PLUS_M, D_MINUS_M, M_MINUS_D, D_AND_M, D_OR_M,
+	PUSH_D, POP_D, CALL, CALL_ROUTINE, RETURN, RETURN_VOID
+};
+
+// the blocks of one program as C++, written by --aot
+#ifdef HACKEMU_AOT
+#include HACKEMU_AOT
+#endif
+
+struct Instruction {
+	Op op;
+	uint8_t dest;   // A D M, high to low as in the encoding
+	uint8_t jump;   // < = >, high to low
+	uint8_t comp;   // a c1..c6, only for ALU
+	uint16_t value; // AT, CALL (index into Hack::calls)
+};
+
+class Hack {
+	friend class Batch;
+private:
+	vector<Instruction> rom;
+	vector<Instruction> unfused; // rom before Fuse, for the last steps before the limit
+	vector<uint16_t> words;      // as loaded, for --aot
+	vector<uint16_t> ram;
+	static const int PAGE_BITS = 8, PAGES = 32768 >> PAGE_BITS;
+	typedef array<uint16_t, 1 << PAGE_BITS> Page;
+	uint64_t program = 0;        // Checksum(words), what snapshots refer to
+	vector<char> dirty;          // per page of RAM, written since the last Save or Restore
+	array<shared_ptr<const Page>, PAGES> clean; // what each page holds unless it is dirty
+	uint16_t a = 0, d = 0, pc = 0;
+	bool halted = false;
+	long long fused = 0;         // fused instructions run
+
+	// what a fused CALL pushes and where it goes
+	struct Call {
+		uint16_t ret, args, target;
+	};
+	vector<Call> calls;
+
+	// the sequence at address at, where ANY stands for any @ instruction; the values of those go to captured
+	static const int ANY = -1;
+	bool Matches(size_t at, const vector<int>& pattern, vector<uint16_t>& captured) {
+		if (at + pattern.size() > words.size()) return false;
+		captured.clear();
+		for (size_t i = 0; i < pattern.size(); ++i) {
+			uint16_t word = words[at + i];
+			if (pattern[i] == ANY) {
+				if (word & 0x8000) return false;
+				captured.push_back(word);
+			} else if (word != pattern[i]) return false;
+		}
+		return true;
+	}
+
+	// comp, dest and jump, the low 13 bits of the word
+	static Op InstructionOp(int bits) {
+		switch (bits) {
+		case 0x1c10: return D_IS_M;
+		case 0x0308: return M_IS_D;
+		case 0x0c10: return D_IS_A;
+		case 0x1c20: return A_IS_M;
+		case 0x1ca0: return A_IS_M_MINUS_1;
+		case 0x0de0: return A_IS_A_PLUS_1;
+		case 0x0ca0: return A_IS_A_MINUS_1;
+		case 0x00a0: return A_IS_D_PLUS_A;
+		case 0x1de8: return AM_IS_M_PLUS_1;
+		case 0x1ca8: return AM_IS_M_MINUS_1;
+		case 0x1dc8: return M_IS_M_PLUS_1;
+		case 0x0a88: return M_IS_0;
+		case 0x0e88: return M_IS_MINUS_1;
+		case 0x1c48: return M_IS_NOT_M;
+		case 0x1088: return M_IS_D_PLUS_M;
+		case 0x11d0: return D_IS_M_MINUS_D;
+		case 0x0a87: return JMP;
+		case 0x0301: return D_JGT;
+		case 0x0302: return D_JEQ;
+		case 0x0303: return D_JGE;
+		case 0x0304: return D_JLT;
+		case 0x0305: return D_JNE;
+		case 0x0306: return D_JLE;
+		}
+		return CompOp(bits >> 6);
+	}
+
+	static Op CompOp(int comp) {
+		switch (comp) {
+		case 0b0101010: return ZERO;
+		case 0b0111111: return ONE;
+		case 0b0111010: return MINUS_ONE;
+		case 0b0001100: return D;
+		case 0b0110000: return A;
+		case 0b0001101: return NOT_D;
+		case 0b0110001: return NOT_A;
+		case 0b0001111: return NEG_D;
+		case 0b0110011: return NEG_A;
+		case 0b0011111: return D_PLUS_1;
+		case 0b0110111: return A_PLUS_1;
+		case 0b0001110: return D_MINUS_1;
+		case 0b0110010: return A_MINUS_1;
+		case 0b0000010: return D_PLUS_A;
+		case 0b0010011: return D_MINUS_A;
+		case 0b0000111: return A_MINUS_D;
+		case 0b0000000: return D_AND_A;
+		case 0b0010101: return D_OR_A;
+		case 0b1110000: return M;
+		case 0b1110001: return NOT_M;
+		case 0b1110011: return NEG_M;
+		case 0b1110111: return M_PLUS_1;
+		case 0b1110010: return M_MINUS_1;
+		case 0b1000010: return D_PLUS_M;
+		case 0b1010011: return D_MINUS_M;
+		case 0b1000111: return M_MINUS_D;
+		case 0b1000000: return D_AND_M;
+		case 0b1010101: return D_OR_M;
+		}
+		return ALU;
+	}
+
+	// comp as a C++ expression of d, a and m, empty if the book does not list it
+	static string CompExpression(int comp, string m) {
+		string x = "d", y = (comp & 0x40) ? m : "a";
+		switch (comp & 0x3f) {
+		case 0b101010: return "0";
+		case 0b111111: return "1";
+		case 0b111010: return "0xffff";
+		case 0b001100: return x;
+		case 0b110000: return y;
+		case 0b001101: return "~" + x;
+		case 0b110001: return "~" + y;
+		case 0b001111: return "-" + x;
+		case 0b110011: return "-" + y;
+		case 0b011111: return x + " + 1";
+		case 0b110111: return y + " + 1";
+		case 0b001110: return x + " - 1";
+		case 0b110010: return y + " - 1";
+		case 0b000010: return x + " + " + y;
+		case 0b010011: return x + " - " + y;
+		case 0b000111: return y + " - " + x;
+		case 0b000000: return x + " & " + y;
+		case 0b010101: return x + " | " + y;
+		}
+		return "";
+	}
+
+	static uint64_t Checksum(const vector<uint16_t>& words) {
+		uint64_t h = 14695981039346656037ULL;
+		for (uint16_t word : words) {
+			h ^= word;
+			h *= 1099511628211ULL;
+		}
+		return h;
+	}
+
+	// the ALU of 02, for comps the book does not list
+	static uint16_t Alu(int comp, uint16_t x, uint16_t y) {
+		if (comp & 0b100000) x = 0;
+		if (comp & 0b010000) x = ~x;
+		if (comp & 0b001000) y = 0;
+		if (comp & 0b000100) y = ~y;
+		uint16_t out = (comp & 0b000010) ? x + y : x & y;
+		return (comp & 0b000001) ? ~out : out;
+	}
+public:
+	static const int SCREEN = 16384, KBD = 24576;
+
+	// the machine at one point: the registers, the RAM as pages, and the program by its checksum.
+	// Snapshots and the machines restored from them share the pages; a machine writes to its own
+	// RAM and copies back only the pages it wrote when it is restored again
+	struct Snapshot {
+		uint16_t a = 0, d = 0, pc = 0;
+		bool halted = false;
+		uint64_t program = 0;
+		array<shared_ptr<const Page>, PAGES> pages;
+	};
+
+	Hack() : rom(32768, Instruction{ END, 0, 0, 0, 0 }), ram(32768), dirty(PAGES, 1) {}
+
+	// a .hack file, one 16-digit binary word per line
+	bool Load(string filename) {
+		ifstream ifs(filename);
+		if (!ifs) return false;
+		string line;
+		vector<uint16_t> program;
+		while (program.size() < 32768 && getline(ifs, line)) {
+			if (line.size() < 16) continue;
+			program.push_back(stoi(line.substr(0, 16), nullptr, 2));
+		}
+		if (getline(ifs, line)) cerr << filename << " does not fit in the 32K ROM, the rest is left out" << endl;
+		Load(program);
+		return true;
+	}
+
+	void Load(const vector<uint16_t>& program) {
+		int address = 0;
+		for (uint16_t word : program) {
+			words.push_back(word);
+			Instruction& in = rom[address++];
+			if (!(word & 0x8000)) {
+				in = { AT, 0, 0, 0, word };
+				continue;
+			}
+			in.comp = (word >> 6) & 0x7f;
+			in.op = InstructionOp(word & 0x1fff);
+			in.dest = (word >> 3) & 7;
+			in.jump = word & 7;
+		}
+		for (int i = 0; i + 1 < address; ++i) {
+			Instruction &at = rom[i], &jmp = rom[i + 1];
+			if (at.op == AT && at.value == i && jmp.op == JMP) at.op = HALT;
+		}
+		this->program = Checksum(words);
+	}
+
+	// the sequences of 08's CodeWriter: PushDToStack, PopDFromStack, a whole call as WriteCall
+	// writes it, the shared call routine of --compact and the return bodies. Each becomes one
+	// instruction at its first address and runs as one, counting every instruction it stands for.
+	// The addresses after it keep their own, so a jump into the middle still works
+	void Fuse() {
+		enum : int {
+			C = 0xe000, D_IS_M = C | 0x1c10, M_IS_D = C | 0x0308, D_IS_A = C | 0x0c10, A_IS_M = C | 0x1c20,
+			A_IS_D = C | 0x0320, M_IS_M_PLUS_1 = C | 0x1dc8, M_IS_M_MINUS_1 = C | 0x1c88, A_IS_M_MINUS_1 = C | 0x1ca0,
+			D_IS_D_MINUS_A = C | 0x04d0, D_IS_D_MINUS_M = C | 0x14d0, D_IS_A_PLUS_1 = C | 0x0dd0, JMP = C | 0x0a87,
+			SP = 0, LCL = 1, ARG = 2, THIS = 3, THAT = 4, R13 = 13, R14 = 14
+		};
+		auto join = [](vector<vector<int> > parts) {
+			vector<int> all;
+			for (auto& part : parts) all.insert(all.end(), part.begin(), part.end());
+			return all;
+		};
+		vector<int> push = { SP, M_IS_M_PLUS_1, A_IS_M_MINUS_1, M_IS_D };
+		vector<int> pop = { SP, M_IS_M_MINUS_1, A_IS_M, D_IS_M };
+		vector<int> frame = push;
+		for (int segment : { LCL, ARG, THIS, THAT }) frame = join({ frame, { segment, D_IS_M }, push });
+		vector<int> call = join({ { ANY, D_IS_A }, frame,
+			{ SP, D_IS_M, LCL, M_IS_D, ANY, D_IS_D_MINUS_A, 5, D_IS_D_MINUS_A, ARG, M_IS_D, ANY, JMP } });
+		vector<int> callroutine = join({ frame,
+			{ SP, D_IS_M, LCL, M_IS_D, R13, D_IS_D_MINUS_M, 5, D_IS_D_MINUS_A, ARG, M_IS_D, R14, A_IS_M, JMP } });
+		vector<int> head = { LCL, D_IS_M, R13, M_IS_D, 5, D_IS_D_MINUS_A, A_IS_D, D_IS_M, R14, M_IS_D };
+		vector<int> restore;
+		for (int i = 1; i <= 4; ++i) restore = join({ restore, { R13, D_IS_M, i, D_IS_D_MINUS_A, A_IS_D, D_IS_M, 5 - i, M_IS_D } });
+		vector<int> tail = { R14, A_IS_M, JMP };
+		vector<int> ret = join({ head, pop, { ARG, A_IS_M, M_IS_D, D_IS_A_PLUS_1, SP, M_IS_D }, restore, tail });
+		vector<int> retvoid = join({ head, { ARG, D_IS_M, SP, M_IS_D }, restore, tail });
+
+		unfused = rom;
+		vector<uint16_t> captured;
+		for (size_t i = 0; i < words.size(); ++i) {
+			if (rom[i].op == HALT) continue;
+			if (Matches(i, call, captured) && captured[1] < 256) {
+				rom[i] = { CALL, 0, 0, 0, (uint16_t)calls.size() };
+				calls.push_back({ captured[0], captured[1], captured[2] });
+			} else if (Matches(i, callroutine, captured)) rom[i].op = CALL_ROUTINE;
+			else if (Matches(i, ret, captured)) rom[i].op = RETURN;
+			else if (Matches(i, retvoid, captured)) rom[i].op = RETURN_VOID;
+			else if (Matches(i, push, captured)) rom[i].op = PUSH_D;
+			else if (Matches(i, pop, captured)) rom[i].op = POP_D;
+		}
+	}
+
+	// every basic block becomes a case of one switch on the PC. Blocks start at 0, after each jump
+	// and at each "@k" that a jump directly follows; they fall through into the next one. A jump
+	// to a known block is a goto, any other jump (A=M;JMP from a return) goes back through the switch,
+	// and an address that starts no block is left to the interpreter
+	void WriteCompiled(ostream& os, string filename) {
+		int size = words.size();
+		set<int> leaders = { 0 };
+		for (int i = 0; i < size; ++i) {
+			if (!(words[i] & 0x8000) || !(words[i] & 7)) continue;
+			if (i + 1 < size) leaders.insert(i + 1);
+			if (i > 0 && !(words[i - 1] & 0x8000) && words[i - 1] < size) leaders.insert(words[i - 1]);
+		}
+
+		os << "// generated by HackEmu --aot from " << filename << ", " << leaders.size() << " blocks" << endl
+			<< "const uint64_t COMPILED_CHECKSUM = " << Checksum(words) << "ULL;" << endl
+			<< endl
+			<< "static inline uint16_t CompiledAlu(int comp, uint16_t x, uint16_t y) {" << endl
+			<< "\tif (comp & 0b100000) x = 0;" << endl
+			<< "\tif (comp & 0b010000) x = ~x;" << endl
+			<< "\tif (comp & 0b001000) y = 0;" << endl
+			<< "\tif (comp & 0b000100) y = ~y;" << endl
+			<< "\tuint16_t out = (comp & 0b000010) ? x + y : x & y;" << endl
+			<< "\treturn (comp & 0b000001) ? ~out : out;" << endl
+			<< "}" << endl
+			<< endl
+			<< "long long CompiledRun(uint16_t* mem, uint16_t& A, uint16_t& D, uint16_t& PC, bool& halted, long long limit) {" << endl
+			<< "\tuint16_t a = A, d = D, v;" << endl
+			<< "\tunsigned pc = PC, t;" << endl
+			<< "\tlong long n = 0;" << endl
+			<< "dispatch:" << endl
+			<< "\tswitch (pc) {" << endl;
+		// the blocks are written first, so that only those a goto reaches get a label. Each falls
+		// through into the next, and says so
+		set<int> targets;
+		vector<string> blocks;
+		for (auto it = leaders.begin(); it != leaders.end(); ++it) {
+			int start = *it, end = next(it) == leaders.end() ? size : *next(it);
+			ostringstream block;
+			if (start + 1 < size && words[start] == start && words[start + 1] == 0xea87) {
+				block << "\t\thalted = true; pc = " << start << "; goto out;" << endl;
+				blocks.push_back(block.str());
+				continue;
+			}
+			block << "\t\tif (n + " << end - start << " > limit) { pc = " << start << "; goto out; }" << endl
+				<< "\t\tn += " << end - start << ";" << endl;
+			int known = -1; // the value of A, when an @ in this block set it
+			for (int i = start; i < end; ++i) {
+				uint16_t word = words[i];
+				if (!(word & 0x8000)) {
+					block << "\t\ta = " << word << ";" << endl;
+					known = word;
+					continue;
+				}
+				int comp = (word >> 6) & 0x7f, dest = (word >> 3) & 7, jump = word & 7;
+				string address = known >= 0 ? to_string(known) : "a & 0x7fff";
+				string m = "mem[" + address + "]";
+				string expression = CompExpression(comp, m);
+				if (expression.empty()) expression = "CompiledAlu(" + to_string(comp & 0x3f) + ", d, " + ((comp & 0x40) ? m : "a") + ")";
+				block << "\t\t";
+				if (jump && known < 0) block << "t = a & 0x7fff; ";
+				block << "v = " << expression << ";";
+				if (dest & 1) block << " " << m << " = v;";
+				if (dest & 2) block << " d = v;";
+				if (dest & 4) block << " a = v;";
+				if (jump) {
+					static const char* CONDITIONS[] = { "", "(int16_t)v > 0", "v == 0", "(int16_t)v >= 0", "(int16_t)v < 0", "v != 0", "(int16_t)v <= 0", "" };
+					string go;
+					if (known >= 0 && leaders.count(known)) {
+						go = "goto B" + to_string(known) + ";";
+						targets.insert(known);
+					} else {
+						go = "{ pc = " + (known >= 0 ? to_string(known) : string("t")) + "; goto dispatch; }";
+					}
+					if (jump == 7) block << " " << go;
+					else block << " if (" << CONDITIONS[jump] << ") " << go;
+				}
+				block << endl;
+				if (dest & 4) known = -1;
+			}
+			blocks.push_back(block.str());
+		}
+		size_t b = 0;
+		for (int start : leaders) {
+			if (start) os << "\t\t[[fallthrough]];" << endl;
+			os << "\tcase " << start << ":";
+			if (targets.count(start)) os << " B" << start << ":";
+			os << endl << blocks[b++];
+		}
+		os << "\t\tpc = " << size << "; goto out;" << endl
+			<< "\t}" << endl
+			<< "out:" << endl
+			<< "\tA = a;" << endl
+			<< "\tD = d;" << endl
+			<< "\tPC = pc;" << endl
+			<< "\treturn n;" << endl
+			<< "}" << endl;
+	}
+
+#ifdef HACKEMU_AOT
+	bool MatchesCompiled() { return Checksum(words) == COMPILED_CHECKSUM; }
+
+	// compiled blocks, with the interpreter for whatever they leave (no block starts there, the last few steps)
+	long long RunCompiled(long long limit) {
+		long long n = 0;
+		while (n < limit && !halted) {
+			n += CompiledRun(ram.data(), a, d, pc, halted, limit - n);
+			if (n < limit && !halted) n += Run(1);
+		}
+		fill(dirty.begin(), dirty.end(), 1); // the compiled code does not track its stores
+		return n;
+	}
+#endif
+
+	uint16_t& Ram(int address) {
+		dirty[(address & 0x7fff) >> PAGE_BITS] = 1;
+		return ram[address & 0x7fff];
+	}
+
+	// the pages written since the last Save or Restore are copied, the others are shared with it
+	Snapshot Save() {
+		Snapshot s;
+		s.a = a, s.d = d, s.pc = pc, s.halted = halted, s.program = program;
+		for (int page = 0; page < PAGES; ++page) {
+			if (page == 0 || dirty[page] || !clean[page]) {
+				auto copy = make_shared<Page>();
+				copy_n(&ram[page << PAGE_BITS], copy->size(), copy->data());
+				clean[page] = copy;
+				dirty[page] = 0;
+			}
+			s.pages[page] = clean[page];
+		}
+		return s;
+	}
+
+	// copies back only the pages that differ from the snapshot: those written since, and those
+	// that came from another snapshot
+	int Restore(const Snapshot& s) {
+		if (s.program != program) throw runtime_error("the snapshot is of another program");
+		int copied = 0;
+		for (int page = 0; page < PAGES; ++page) {
+			if (page != 0 && !dirty[page] && clean[page] == s.pages[page]) continue;
+			copy_n(s.pages[page]->data(), s.pages[page]->size(), &ram[page << PAGE_BITS]);
+			clean[page] = s.pages[page];
+			dirty[page] = 0;
+			++copied;
+		}
+		a = s.a, d = s.d, pc = s.pc, halted = s.halted;
+		return copied;
+	}
+
+	uint64_t RamChecksum() const { return Checksum(ram); }
+
+	uint16_t PC() { return pc; }
+
+	uint16_t& ARegister() { return a; }
+
+	uint16_t& DRegister() { return d; }
+
+	// continues at address, also after a halt
+	void Jump(uint16_t address) {
+		pc = address & 0x7fff;
+		halted = false;
+	}
+
+	bool Halted() { return halted; }
+
+	long long Fused() { return fused; }
+
+	// runs up to limit instructions and returns how many ran
+	long long Run(long long limit) { return Interpret<false>(limit, ram.data(), 1, nullptr); }
+
+	// Run on the RAM at mem, or (Strided, for Batch) on an instance of a batch whose words are
+	// stride apart, which also stops where stops marks the PC
+	template <bool Strided>
+	long long Interpret(long long limit, uint16_t* mem, size_t stride, const char* stops) {
+		const Instruction* code = rom.data();
+		const size_t step = Strided ? stride : 1;
+		char* written = dirty.data();
+		uint16_t a = this->a, d = this->d, v;
+		unsigned pc = this->pc;
+		long long n = 0;
+		const Instruction* in = &code[pc];
+		if (halted || limit <= 0) return 0;
+		// the page of a store, for Restore. Page 0 is always copied, so the stores to SP, LCL,
+		// ARG, THIS, THAT, temp and R13-R15 need none
+#define WROTE(address) (written[((address) & 0x7fff) >> PAGE_BITS] = 1)
+#define RAM(address) mem[((address) & 0x7fff) * step]
+
+#if defined(__GNUC__) && !defined(HACKEMU_SWITCH)
+		// same order as Op
+		static const void* labels[] = {
+			&&L_AT, &&L_HALT, &&L_END,
+			&&L_D_IS_M, &&L_M_IS_D, &&L_D_IS_A, &&L_A_IS_M, &&L_A_IS_M_MINUS_1, &&L_A_IS_A_PLUS_1, &&L_A_IS_A_MINUS_1, &&L_A_IS_D_PLUS_A,
+			&&L_AM_IS_M_PLUS_1, &&L_AM_IS_M_MINUS_1, &&L_M_IS_M_PLUS_1, &&L_M_IS_0, &&L_M_IS_MINUS_1, &&L_M_IS_NOT_M, &&L_M_IS_D_PLUS_M, &&L_D_IS_M_MINUS_D,
+			&&L_JMP, &&L_D_JGT, &&L_D_JEQ, &&L_D_JGE, &&L_D_JLT, &&L_D_JNE, &&L_D_JLE,
+			&&L_ALU,
+			&&L_ZERO, &&L_ONE, &&L_MINUS_ONE, &&L_D, &&L_A, &&L_NOT_D, &&L_NOT_A, &&L_NEG_D, &&L_NEG_A,
+			&&L_D_PLUS_1, &&L_A_PLUS_1, &&L_D_MINUS_1, &&L_A_MINUS_1, &&L_D_PLUS_A, &&L_D_MINUS_A, &&L_A_MINUS_D, &&L_D_AND_A, &&L_D_OR_A,
+			&&L_M, &&L_NOT_M, &&L_NEG_M, &&L_M_PLUS_1, &&L_M_MINUS_1, &&L_D_PLUS_M, &&L_D_MINUS_M, &&L_M_MINUS_D, &&L_D_AND_M, &&L_D_OR_M,
+			&&L_PUSH_D, &&L_POP_D, &&L_CALL, &&L_CALL_ROUTINE, &&L_RETURN, &&L_RETURN_VOID
+		};
+#define OP(name) L_##name
+#define NEXT() do { if (++n == limit) goto done; in = &code[pc]; goto *labels[in->op]; } while (0)
+		goto *labels[in->op];
+#else
+#define OP(name) case name
+#define NEXT() do { if (++n == limit) goto done; in = &code[pc]; goto dispatch; } while (0)
+	dispatch:
+		switch (in->op) {
+#endif
+		// a group waits only where a jump goes (or at the PC it started from), so only jumps look at stops
+#define JUMPED() do { if (Strided && stops[pc]) { ++n; goto done; } NEXT(); } while (0)
+		OP(AT): a = in->value; ++pc; NEXT();
+		OP(HALT): halted = true; goto done;
+		OP(END): halted = true; goto done;
+		OP(D_IS_M): d = RAM(a); ++pc; NEXT();
+		OP(M_IS_D): RAM(a) = d; WROTE(a); ++pc; NEXT();
+		OP(D_IS_A): d = a; ++pc; NEXT();
+		OP(A_IS_M): a = RAM(a); ++pc; NEXT();
+		OP(A_IS_M_MINUS_1): a = RAM(a) - 1; ++pc; NEXT();
+		OP(A_IS_A_PLUS_1): ++a; ++pc; NEXT();
+		OP(A_IS_A_MINUS_1): --a; ++pc; NEXT();
+		OP(A_IS_D_PLUS_A): a += d; ++pc; NEXT();
+		OP(AM_IS_M_PLUS_1): WROTE(a); a = ++RAM(a); ++pc; NEXT();
+		OP(AM_IS_M_MINUS_1): WROTE(a); a = --RAM(a); ++pc; NEXT();
+		OP(M_IS_M_PLUS_1): ++RAM(a); WROTE(a); ++pc; NEXT();
+		OP(M_IS_0): RAM(a) = 0; WROTE(a); ++pc; NEXT();
+		OP(M_IS_MINUS_1): RAM(a) = 0xffff; WROTE(a); ++pc; NEXT();
+		OP(M_IS_NOT_M): RAM(a) = ~RAM(a); WROTE(a); ++pc; NEXT();
+		OP(M_IS_D_PLUS_M): RAM(a) += d; WROTE(a); ++pc; NEXT();
+		OP(D_IS_M_MINUS_D): d = RAM(a) - d; ++pc; NEXT();
+		OP(JMP): pc = a & 0x7fff; JUMPED();
+		OP(D_JGT): pc = (int16_t)d > 0 ? a & 0x7fff : pc + 1; JUMPED();
+		OP(D_JEQ): pc = d == 0 ? a & 0x7fff : pc + 1; JUMPED();
+		OP(D_JGE): pc = (int16_t)d >= 0 ? a & 0x7fff : pc + 1; JUMPED();
+		OP(D_JLT): pc = (int16_t)d < 0 ? a & 0x7fff : pc + 1; JUMPED();
+		OP(D_JNE): pc = d != 0 ? a & 0x7fff : pc + 1; JUMPED();
+		OP(D_JLE): pc = (int16_t)d <= 0 ? a & 0x7fff : pc + 1; JUMPED();
+		OP(ALU): v = Alu(in->comp, d, (in->comp & 0x40) ? RAM(a) : a); goto store;
+		OP(ZERO): v = 0; goto store;
+		OP(ONE): v = 1; goto store;
+		OP(MINUS_ONE): v = 0xffff; goto store;
+		OP(D): v = d; goto store;
+		OP(A): v = a; goto store;
+		OP(NOT_D): v = ~d; goto store;
+		OP(NOT_A): v = ~a; goto store;
+		OP(NEG_D): v = -d; goto store;
+		OP(NEG_A): v = -a; goto store;
+		OP(D_PLUS_1): v = d + 1; goto store;
+		OP(A_PLUS_1): v = a + 1; goto store;
+		OP(D_MINUS_1): v = d - 1; goto store;
+		OP(A_MINUS_1): v = a - 1; goto store;
+		OP(D_PLUS_A): v = d + a; goto store;
+		OP(D_MINUS_A): v = d - a; goto store;
+		OP(A_MINUS_D): v = a - d; goto store;
+		OP(D_AND_A): v = d & a; goto store;
+		OP(D_OR_A): v = d | a; goto store;
+		OP(M): v = RAM(a); goto store;
+		OP(NOT_M): v = ~RAM(a); goto store;
+		OP(NEG_M): v = -RAM(a); goto store;
+		OP(M_PLUS_1): v = RAM(a) + 1; goto store;
+		OP(M_MINUS_1): v = RAM(a) - 1; goto store;
+		OP(D_PLUS_M): v = d + RAM(a); goto store;
+		OP(D_MINUS_M): v = d - RAM(a); goto store;
+		OP(M_MINUS_D): v = RAM(a) - d; goto store;
+		OP(D_AND_M): v = d & RAM(a); goto store;
+		OP(D_OR_M): v = d | RAM(a); goto store;
+		// each does what its instructions do, in their order, and counts them all; when they
+		// would run past the limit the first instruction runs alone
+#define FUSED(length) do { if (n + (length) > limit) goto plain; ++fused; n += (length) - 1; } while (0)
+#define PUSH() do { a = RAM(0); RAM(0) = a + 1; RAM(a) = d; WROTE(a); } while (0)
+#define RESTORE() do { for (int i = 1; i <= 4; ++i) { a = RAM(13) - i; d = RAM(a); RAM(5 - i) = d; } a = RAM(14); pc = a & 0x7fff; } while (0)
+		OP(PUSH_D): FUSED(4); PUSH(); pc += 4; NEXT();
+		OP(POP_D): FUSED(4); a = --RAM(0); d = RAM(a); pc += 4; NEXT();
+		OP(CALL):
+			FUSED(42);
+			{
+				const Call& call = calls[in->value];
+				d = call.ret;
+				PUSH();
+				for (int segment = 1; segment <= 4; ++segment) {
+					d = RAM(segment);
+					PUSH();
+				}
+				d = RAM(0);
+				RAM(1) = d;
+				d = d - call.args - 5;
+				RAM(2) = d;
+				a = call.target;
+				pc = a & 0x7fff;
+			}
+			JUMPED();
+		OP(CALL_ROUTINE):
+			FUSED(41);
+			PUSH();
+			for (int segment = 1; segment <= 4; ++segment) {
+				d = RAM(segment);
+				PUSH();
+			}
+			d = RAM(0);
+			RAM(1) = d;
+			d = d - RAM(13) - 5;
+			RAM(2) = d;
+			a = RAM(14);
+			pc = a & 0x7fff;
+			JUMPED();
+		OP(RETURN):
+			FUSED(55);
+			RAM(13) = RAM(1);
+			a = RAM(1) - 5;
+			RAM(14) = RAM(a);
+			a = --RAM(0);
+			d = RAM(a);
+			a = RAM(2);
+			RAM(a) = d;
+			WROTE(a);
+			RAM(0) = a + 1;
+			RESTORE();
+			JUMPED();
+		OP(RETURN_VOID):
+			FUSED(49);
+			RAM(13) = RAM(1);
+			a = RAM(1) - 5;
+			RAM(14) = RAM(a);
+			RAM(0) = RAM(2);
+			RESTORE();
+			JUMPED();
+#undef FUSED
+#undef PUSH
+#undef RESTORE
+#if !defined(__GNUC__) || defined(HACKEMU_SWITCH)
+		}
+#endif
+#undef OP
+#undef NEXT
+#undef JUMPED
+
+	plain:
+		in = &unfused[pc];
+#if defined(__GNUC__) && !defined(HACKEMU_SWITCH)
+		goto *labels[in->op];
+#else
+		goto dispatch;
+#endif
+
+	store:
+		// M goes to the old A, and the jump target is the old A too
+		{
+			unsigned target = a & 0x7fff;
+			if (in->dest & 1) RAM(target) = v, WROTE(target);
+			if (in->dest & 2) d = v;
+			if (in->dest & 4) a = v;
+			int16_t s = v;
+			int cond = s < 0 ? 4 : s == 0 ? 2 : 1;
+			pc = (in->jump & cond) ? target : pc + 1;
+		}
+		if (++n == limit || (Strided && in->jump && stops[pc])) goto done;
+		in = &code[pc];
+#if defined(__GNUC__) && !defined(HACKEMU_SWITCH)
+		goto *labels[in->op];
+#else
+		goto dispatch;
+#endif
+
+	done:
+#undef WROTE
+#undef RAM
+		this->a = a;
+		this->d = d;
+		this->pc = pc;
+		return n;
+	}
+
+	// 512x256, one bit per pixel, as a plain PBM
+	void WriteScreen(string filename) {
+		ofstream ofs(filename);
+		ofs << "P1" << endl << "512 256" << endl;
+		for (int row = 0; row < 256; ++row) {
+			for (int col = 0; col < 512; ++col)
+				ofs << ((ram[SCREEN + row * 32 + col / 16] >> (col % 16)) & 1) << (col % 64 == 63 ? "\n" : " ");
+		}
+	}
+};
+
+// cycles per VM function and line, from the map Assembler --map writes next to the .hack.
+// A call is the PC arriving at the first address of a VM function from the instruction the new
+// frame returns after (the caller left that address at LCL-5), from the shared call routine of
+// --compact, or from another function. The frame ends when the PC arrives at its return address
+class Profiler {
+private:
+	struct Frame {
+		int function, caller, node;
+		uint16_t ret;
+		long long start;
+	};
+	// one per call path, for the collapsed stacks
+	struct Node {
+		int parent, function;
+		map<int, int> children;
+		long long self = 0;
+	};
+
+	vector<string> functions, lines;
+	vector<int> functionof, rowof; // per ROM address
+	vector<bool> entry;            // the first address of a VM function
+	vector<long long> self, inclusive, calls, active, since, linecycles;
+	map<pair<int, int>, pair<long long, long long> > edges; // caller, callee: calls, cycles
+	vector<Frame> stack;
+	vector<Node> nodes = { { -1, -1, {}, 0 } };
+	long long cycles = 0;
+	int root = 0, callroutine = -1;
+
+	int Child(int node, int function) {
+		auto it = nodes[node].children.find(function);
+		if (it != nodes[node].children.end()) return it->second;
+		nodes.push_back({ node, function, {}, 0 });
+		return nodes[node].children[function] = nodes.size() - 1;
+	}
+
+	void Call(int function, uint16_t ret) {
+		int caller = stack.empty() ? root : stack.back().function;
+		++calls[function];
+		++edges[{ caller, function }].first;
+		if (active[function]++ == 0) since[function] = cycles;
+		stack.push_back({ function, caller, Child(stack.empty() ? 0 : stack.back().node, function), ret, cycles });
+	}
+
+	void Return() {
+		Frame frame = stack.back();
+		stack.pop_back();
+		if (--active[frame.function] == 0) inclusive[frame.function] += cycles - frame.start;
+		edges[{ frame.caller, frame.function }].second += cycles - frame.start;
+	}
+
+	static string Percent(long long part, long long whole) {
+		ostringstream os;
+		os << fixed << setprecision(2) << (whole ? 100.0 * part / whole : 0);
+		return os.str();
+	}
+public:
+	bool Load(string filename) {
+		ifstream ifs(filename);
+		string header, file, function;
+		int address, line;
+		if (!getline(ifs, header) || header != "// map") return false;
+		map<string, int> index;
+		vector<pair<int, int> > rows; // address, function
+		while (ifs >> address >> file >> line >> function && address < 32768) {
+			auto it = index.emplace(function, functions.size());
+			if (it.second) functions.push_back(function);
+			rows.push_back({ address, it.first->second });
+			lines.push_back(file == "-" ? function : file + ":" + to_string(line));
+		}
+		if (rows.empty()) return false;
+		functionof.assign(32768, rows[0].second);
+		rowof.assign(32768, 0);
+		entry.assign(32768, false);
+		vector<bool> seen(functions.size());
+		for (size_t i = 0; i < rows.size(); ++i) {
+			int end = i + 1 < rows.size() ? rows[i + 1].first : 32768;
+			for (int a = rows[i].first; a < end; ++a) {
+				functionof[a] = rows[i].second;
+				rowof[a] = i;
+			}
+			if (!seen[rows[i].second] && lines[i][0] != '(') entry[rows[i].first] = true;
+			seen[rows[i].second] = true;
+		}
+		root = functionof[0];
+		if (index.count("(call)")) callroutine = index["(call)"];
+		for (auto* v : { &self, &inclusive, &calls, &active, &since }) v->assign(functions.size(), 0);
+		linecycles.assign(rows.size(), 0);
+		return true;
+	}
+
+	// one instruction at a time, as Hack::Run would run them
+	long long Run(Hack& hack, long long limit) {
+		long long n = 0;
+		int lastnode = -1, lastfunction = -1, leaf = 0;
+		while (n < limit) {
+			unsigned pc = hack.PC();
+			if (hack.Run(1) == 0) break;
+			++n;
+			++cycles;
+			int function = functionof[pc];
+			++self[function];
+			++linecycles[rowof[pc]];
+			int node = stack.empty() ? 0 : stack.back().node;
+			if (node != lastnode || function != lastfunction) {
+				leaf = nodes[node].function == function ? node : Child(node, function);
+				lastnode = node;
+				lastfunction = function;
+			}
+			++nodes[leaf].self;
+
+			unsigned next = hack.PC();
+			if (next == pc + 1) continue;
+			// a return address can be the first address of the function after it, so calls go first
+			uint16_t ret = hack.Ram(hack.Ram(1) - 5);
+			if (entry[next] && (ret == pc + 1 || function == callroutine)) Call(functionof[next], ret);
+			else if (!stack.empty() && next == stack.back().ret) Return();
+			else if (entry[next] && functionof[next] != function) Call(functionof[next], ret);
+		}
+		// the frames still open count up to here
+		while (!stack.empty()) Return();
+		return n;
+	}
+
+	void Print(ostream& os) {
+		vector<int> order(functions.size());
+		for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+		sort(order.begin(), order.end(), [&](int a, int b) { return self[a] > self[b]; });
+		os << "flat profile, " << cycles << " cycles" << endl
+			<< setw(8) << "self %" << setw(14) << "self" << setw(14) << "inclusive" << setw(10) << "calls" << "  function" << endl;
+		for (int f : order) {
+			if (!self[f] && !calls[f]) continue;
+			os << setw(8) << Percent(self[f], cycles) << setw(14) << self[f] << setw(14) << inclusive[f]
+				<< setw(10) << calls[f] << "  " << functions[f] << endl;
+		}
+
+		sort(order.begin(), order.end(), [&](int a, int b) { return inclusive[a] > inclusive[b]; });
+		os << endl << "call graph, callers and callees of each function with the cycles spent in those calls" << endl;
+		for (int f : order) {
+			if (!calls[f]) continue;
+			os << functions[f] << "  " << Percent(inclusive[f], cycles) << "% inclusive, " << calls[f] << " calls" << endl;
+			for (auto& [edge, value] : edges)
+				if (edge.second == f) os << "    from " << functions[edge.first] << "  " << value.first << " calls, " << value.second << " cycles" << endl;
+			for (auto& [edge, value] : edges)
+				if (edge.first == f) os << "    to   " << functions[edge.second] << "  " << value.first << " calls, " << value.second << " cycles" << endl;
+		}
+
+		vector<int> rows(lines.size());
+		for (size_t i = 0; i < rows.size(); ++i) rows[i] = i;
+		sort(rows.begin(), rows.end(), [&](int a, int b) { return linecycles[a] > linecycles[b]; });
+		os << endl << "hottest VM lines" << endl;
+		for (size_t i = 0; i < rows.size() && i < 20 && linecycles[rows[i]]; ++i)
+			os << setw(8) << Percent(linecycles[rows[i]], cycles) << setw(14) << linecycles[rows[i]] << "  " << lines[rows[i]] << endl;
+	}
+
+	// "Sys.init;Main.main;Output.printString 1234" per call path, for flamegraph.pl and the like
+	void WriteCollapsed(ostream& os) {
+		for (size_t i = 1; i < nodes.size(); ++i) {
+			if (!nodes[i].self) continue;
+			string path;
+			for (int n = i; n > 0; n = nodes[n].parent) path = functions[nodes[n].function] + (path.empty() ? "" : ";") + path;
+			os << path << " " << nodes[i].self << endl;
+		}
+	}
+};
+
+// many copies of one program side by side, each with its own RAM, for running it on many inputs.
+// The registers are arrays with an element per instance (a, d, pc) and the RAMs follow each other.
+// The instances at one PC form a group, and each instruction runs for the whole group in one
+// loop per step of it, without branches, so the compiler can vectorize the loops over a whole
+// batch. A jump splits a group when its members go different ways, and a group that arrives where
+// another one waits merges with it. The waiting group with the lowest PC runs next, so the ones
+// still in a loop catch up with those past it. Lockstep costs more than it saves for a few
+// instances, so the members of a group smaller than SMALL run one at a time on the interpreter
+// of Hack, each until it reaches the limit or arrives where a group waits, and joins that group
+class Batch {
+private:
+	enum Kind : uint8_t { LOAD, COMPUTE, STOP }; // STOP is HALT or END
+	struct Code {
+		Kind kind;
+		uint8_t comp, dest, jump;
+		uint16_t value;
+	};
+	struct Group {
+		vector<int> lanes; // in order
+		long long ran = 0; // steps not yet added to the lanes' counts
+		long long budget = 0; // steps until the first member reaches the limit
+	};
+	static const size_t WORDS = 32768;
+	// below this many members lockstep is slower than one at a time: about 32 with AVX2 (two
+	// vectors), and without it the scalar loops stay slower even for 1000 instances
+#ifdef __AVX2__
+	static const int SMALL = 32;
+#else
+	static const int SMALL = 1024;
+#endif
+
+	Hack solo; // runs the instances of small groups, with the RAM in place
+	vector<Code> code;
+	int n;
+	vector<uint16_t> a, d, pc;
+	vector<uint16_t> ram;
+	vector<char> halted;
+	vector<long long> steps;    // in this Run
+	vector<uint16_t> x, w, y, v, target; // per member of the running group: A, D, the ALU's y and out, the next PC
+	map<unsigned, Group> groups;   // waiting, by PC; their lanes' pc and steps are up to date
+	vector<char> waiting;          // per PC
+	long long limit = 0;
+	long long together = 0, alone = 0, groupsteps = 0;
+
+	// the members' pc and steps
+	void Flush(Group& g, unsigned p) {
+		for (int lane : g.lanes) {
+			steps[lane] += g.ran;
+			pc[lane] = p;
+		}
+		g.ran = 0;
+	}
+	// the lanes that reached the limit leave
+	void Retire(Group& g) {
+		g.lanes.erase(remove_if(g.lanes.begin(), g.lanes.end(), [&](int lane) { return steps[lane] >= limit; }), g.lanes.end());
+		long long most = 0;
+		for (int lane : g.lanes) most = max(most, steps[lane]);
+		g.budget = limit - most;
+	}
+	// lanes, flushed and in order, join the group waiting at p
+	void Merge(unsigned p, const vector<int>& lanes) {
+		Group& w = groups[p];
+		waiting[p] = 1;
+		size_t middle = w.lanes.size();
+		w.lanes.insert(w.lanes.end(), lanes.begin(), lanes.end());
+		inplace_merge(w.lanes.begin(), w.lanes.begin() + middle, w.lanes.end());
+		Retire(w);
+	}
+
+	// whether the 15-bit addresses xs are all the same
+	static bool Same(const uint16_t* xs, size_t count) {
+		size_t k = 0;
+		uint16_t spread = 0;
+#ifdef __AVX2__
+		__m256i first = _mm256_set1_epi16(xs[0]), any = _mm256_setzero_si256();
+		for (; k + 16 <= count; k += 16)
+			any = _mm256_or_si256(any, _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(xs + k)), first));
+		any = _mm256_and_si256(any, _mm256_set1_epi16(0x7fff));
+		if (!_mm256_testz_si256(any, any)) return false;
+#endif
+		for (; k < count; ++k) spread |= xs[k] ^ xs[0];
+		return !(spread & 0x7fff);
+	}
+
+	// the ALU of 02 on each pair of xs (D) and ys (A or M), with its control bits as masks
+	static void Alu(int comp, const uint16_t* xs, const uint16_t* ys, uint16_t* out, size_t count) {
+		uint16_t zx = comp & 0x20 ? 0 : 0xffff, nx = comp & 0x10 ? 0xffff : 0;
+		uint16_t zy = comp & 0x08 ? 0 : 0xffff, ny = comp & 0x04 ? 0xffff : 0;
+		uint16_t f = comp & 0x02 ? 0xffff : 0, no = comp & 0x01 ? 0xffff : 0;
+		size_t k = 0;
+#ifdef __AVX2__
+		__m256i mzx = _mm256_set1_epi16(zx), mnx = _mm256_set1_epi16(nx), mzy = _mm256_set1_epi16(zy);
+		__m256i mny = _mm256_set1_epi16(ny), mf = _mm256_set1_epi16(f), mno = _mm256_set1_epi16(no);
+		for (; k + 16 <= count; k += 16) {
+			__m256i x = _mm256_xor_si256(_mm256_and_si256(_mm256_loadu_si256((const __m256i*)(xs + k)), mzx), mnx);
+			__m256i y = _mm256_xor_si256(_mm256_and_si256(_mm256_loadu_si256((const __m256i*)(ys + k)), mzy), mny);
+			__m256i both = _mm256_and_si256(x, y), sum = _mm256_add_epi16(x, y);
+			_mm256_storeu_si256((__m256i*)(out + k), _mm256_xor_si256(_mm256_blendv_epi8(both, sum, mf), mno));
+		}
+#endif
+		for (; k < count; ++k) {
+			uint16_t x = (xs[k] & zx) ^ nx, y = (ys[k] & zy) ^ ny;
+			out[k] = (((x + y) & f) | (x & y & ~f)) ^ no;
+		}
+	}
+
+	// where each goes after a jump on the values vs, to its old A or to next. True if all go the same way
+	static bool Jumps(int jump, const uint16_t* vs, const uint16_t* as, uint16_t* target, size_t count, uint16_t next) {
+		size_t k = 0;
+		uint16_t spread = 0;
+#ifdef __AVX2__
+		__m256i lt = _mm256_set1_epi16(jump & 4 ? -1 : 0), eq = _mm256_set1_epi16(jump & 2 ? -1 : 0), gt = _mm256_set1_epi16(jump & 1 ? -1 : 0);
+		__m256i zero = _mm256_setzero_si256(), low = _mm256_set1_epi16(0x7fff), after = _mm256_set1_epi16(next), any = zero, first = zero;
+		for (; k + 16 <= count; k += 16) {
+			__m256i v = _mm256_loadu_si256((const __m256i*)(vs + k));
+			__m256i neg = _mm256_cmpgt_epi16(zero, v), nil = _mm256_cmpeq_epi16(v, zero), pos = _mm256_cmpgt_epi16(v, zero);
+			__m256i taken = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(neg, lt), _mm256_and_si256(nil, eq)), _mm256_and_si256(pos, gt));
+			__m256i to = _mm256_blendv_epi8(after, _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(as + k)), low), taken);
+			_mm256_storeu_si256((__m256i*)(target + k), to);
+			if (k == 0) first = _mm256_set1_epi16(target[0]);
+			any = _mm256_or_si256(any, _mm256_xor_si256(to, first));
+		}
+		if (!_mm256_testz_si256(any, any)) spread = 1;
+#endif
+		for (; k < count; ++k) {
+			int16_t s = vs[k];
+			int cond = s < 0 ? 4 : s == 0 ? 2 : 1;
+			target[k] = (jump & cond) ? as[k] & 0x7fff : next;
+			spread |= target[k] ^ target[0];
+		}
+		return !spread;
+	}
+
+	// the instruction at p for every member. True if they all go on to the same next, otherwise
+	// target holds where each goes. For the whole batch the registers are already side by side,
+	// and M is one row of the RAM when every member has the same A, as after "@SP"
+	template <bool All>
+	bool Execute(const Group& g, unsigned p, unsigned& next) {
+		const Code c = code[p];
+		const int* lanes = g.lanes.data();
+		size_t count = g.lanes.size();
+		auto lane = [lanes](size_t k) { return All ? (int)k : lanes[k]; };
+		uint16_t* as = a.data();
+		uint16_t* ds = d.data();
+		uint16_t* mem = ram.data();
+		next = p + 1;
+		if (c.kind == LOAD) {
+			if (All) fill(as, as + count, c.value);
+			else for (size_t k = 0; k < count; ++k) as[lanes[k]] = c.value;
+			return true;
+		}
+
+		const uint16_t* olda = as;
+		const uint16_t* oldd = ds;
+		if (!All) {
+			for (size_t k = 0; k < count; ++k) x[k] = as[lanes[k]], w[k] = ds[lanes[k]];
+			olda = x.data();
+			oldd = w.data();
+		}
+		uint16_t* row = nullptr;
+		if (((c.comp & 0x40) || (c.dest & 1)) && Same(olda, count)) row = mem + (size_t)(olda[0] & 0x7fff) * n;
+		if (!(c.comp & 0x40)) copy(olda, olda + count, y.data());
+		else if (row && All) copy(row, row + count, y.data());
+		else for (size_t k = 0; k < count; ++k) y[k] = mem[(size_t)(olda[k] & 0x7fff) * n + lane(k)];
+		Alu(c.comp, oldd, y.data(), v.data(), count);
+
+		// M and the jump target are the old A
+		bool same = true;
+		if (c.jump) {
+			same = Jumps(c.jump, v.data(), olda, target.data(), count, p + 1);
+			next = target[0];
+		}
+		if ((c.dest & 1) && row && All) copy(v.begin(), v.begin() + count, row);
+		else if (c.dest & 1)
+			for (size_t k = 0; k < count; ++k) mem[(size_t)(olda[k] & 0x7fff) * n + lane(k)] = v[k];
+		if ((c.dest & 2) && All) copy(v.begin(), v.begin() + count, ds);
+		else if (c.dest & 2)
+			for (size_t k = 0; k < count; ++k) ds[lanes[k]] = v[k];
+		if ((c.dest & 4) && All) copy(v.begin(), v.begin() + count, as);
+		else if (c.dest & 4)
+			for (size_t k = 0; k < count; ++k) as[lanes[k]] = v[k];
+		return same;
+	}
+
+	// one instance alone until it reaches the limit, stops, or arrives where a group waits
+	void RunAlone(int lane, unsigned p) {
+		solo.a = a[lane], solo.d = d[lane], solo.pc = p, solo.halted = false;
+		long long ran = solo.Interpret<true>(limit - steps[lane], ram.data() + lane, n, waiting.data());
+		alone += ran;
+		steps[lane] += ran;
+		a[lane] = solo.a, d[lane] = solo.d, pc[lane] = solo.pc;
+		halted[lane] = solo.halted;
+		if (!solo.halted && steps[lane] < limit) Merge(solo.pc, { lane });
+	}
+
+	// a group from the lowest waiting PC until it stops, splits or merges
+	void RunGroup(Group g, unsigned p) {
+		for (;;) {
+			if (g.budget <= 0) {
+				Flush(g, p);
+				Retire(g);
+				if (g.lanes.empty()) return;
+			}
+			if (code[p].kind == STOP) {
+				Flush(g, p);
+				for (int lane : g.lanes) halted[lane] = 1;
+				return;
+			}
+			if ((int)g.lanes.size() < SMALL) {
+				Flush(g, p);
+				for (int lane : g.lanes) RunAlone(lane, p);
+				return;
+			}
+			unsigned next;
+			bool same = (int)g.lanes.size() == n ? Execute<true>(g, p, next) : Execute<false>(g, p, next);
+			++g.ran;
+			--g.budget;
+			++groupsteps;
+			together += g.lanes.size();
+			if (same) {
+				p = next;
+				if (!waiting[p]) continue;
+				Flush(g, p);
+				Merge(p, g.lanes);
+				return;
+			}
+			// each way becomes a group of its own, or joins the one waiting there
+			Flush(g, p);
+			map<unsigned, vector<int> > ways;
+			for (size_t k = 0; k < g.lanes.size(); ++k) {
+				pc[g.lanes[k]] = target[k];
+				ways[target[k]].push_back(g.lanes[k]);
+			}
+			for (auto& [to, lanes] : ways) Merge(to, lanes);
+			return;
+		}
+	}
+public:
+	// n copies of the machine as it is: the same program, registers and RAM
+	Batch(const Hack& hack, int n) : solo(hack), code(WORDS + 1, { STOP, 0, 0, 0, 0 }), n(n), a(n, hack.a), d(n, hack.d), pc(n, hack.pc),
+		ram(n * WORDS), halted(n, hack.halted), steps(n, 0), x(n), w(n), y(n), v(n), target(n), waiting(WORDS + 1, 0) {
+		for (size_t i = 0; i < hack.words.size(); ++i) {
+			uint16_t word = hack.words[i];
+			if (hack.rom[i].op == HALT) continue;
+			if (word & 0x8000) code[i] = { COMPUTE, (uint8_t)((word >> 6) & 0x7f), (uint8_t)((word >> 3) & 7), (uint8_t)(word & 7), 0 };
+			else code[i] = { LOAD, 0, 0, 0, word };
+		}
+		for (size_t address = 0; address < WORDS; ++address)
+			fill(ram.begin() + address * n, ram.begin() + (address + 1) * n, hack.ram[address]);
+	}
+
+	int Size() { return n; }
+
+	uint16_t& Ram(int instance, int address) { return ram[(address & 0x7fff) * (size_t)n + instance]; }
+
+	uint16_t ARegister(int instance) { return a[instance]; }
+
+	uint16_t DRegister(int instance) { return d[instance]; }
+
+	uint16_t PC(int instance) { return pc[instance]; }
+
+	bool Halted(int instance) { return halted[instance]; }
+
+	// instructions run in groups of two or more, and the steps those groups took
+	long long Together() { return together; }
+
+	long long GroupSteps() { return groupsteps; }
+
+	// runs every instance up to limit instructions, as Hack::Run would, and returns how many ran in all
+	long long Run(long long limit) {
+		this->limit = limit;
+		fill(steps.begin(), steps.end(), 0);
+		for (int i = 0; i < n; ++i)
+			if (!halted[i] && limit > 0) groups[pc[i]].lanes.push_back(i);
+		for (auto& [p, g] : groups) {
+			waiting[p] = 1;
+			g.budget = limit;
+		}
+		while (!groups.empty()) {
+			auto it = groups.begin();
+			unsigned p = it->first;
+			Group g = move(it->second);
+			groups.erase(it);
+			waiting[p] = 0;
+			RunGroup(move(g), p);
+		}
+		long long total = 0;
+		for (long long s : steps) total += s;
+		return total;
+	}
+};
+
+#ifndef NO_MAIN
+int main(int argc, char** argv) {
+	string filename, screenfile, aotfile, collapsedfile;
+	bool compiled = false, profile = false, fuse = true, check = false;
+	long long steps = LLONG_MAX;
+	vector<pair<int, int> > sets, prints, randoms;
+	int key = 0, batch = 0, warmto = -1, repeat = 0;
+	long long warm = 0;
+	uint64_t seed = 1;
+	for (int i = 1; i < argc; ++i) {
+		string arg = argv[i];
+		if (arg == "--steps" && i + 1 < argc) steps = stoll(argv[++i]);
+		else if (arg == "--ram" && i + 1 < argc) {
+			// address=value
+			string s = argv[++i];
+			size_t eq = s.find('=');
+			sets.push_back({ stoi(s.substr(0, eq)), stoi(s.substr(eq + 1)) });
+		} else if (arg == "--print" && i + 1 < argc) {
+			// address or first-last
+			string s = argv[++i];
+			size_t dash = s.find('-');
+			int first = stoi(s.substr(0, dash));
+			prints.push_back({ first, dash == string::npos ? first : stoi(s.substr(dash + 1)) });
+		} else if (arg == "--screen" && i + 1 < argc) screenfile = argv[++i];
+		else if (arg == "--key" && i + 1 < argc) key = stoi(argv[++i]);
+		else if (arg == "--aot" && i + 1 < argc) aotfile = argv[++i];
+		else if (arg == "--compiled") compiled = true;
+		else if (arg == "--profile") profile = true;
+		else if (arg == "--no-fuse") fuse = false;
+		else if (arg == "--collapsed" && i + 1 < argc) collapsedfile = argv[++i];
+		else if (arg == "--batch" && i + 1 < argc) batch = stoi(argv[++i]);
+		else if (arg == "--random" && i + 1 < argc) {
+			// address or first-last
+			string s = argv[++i];
+			size_t dash = s.find('-');
+			int first = stoi(s.substr(0, dash));
+			randoms.push_back({ first, dash == string::npos ? first : stoi(s.substr(dash + 1)) });
+		} else if (arg == "--seed" && i + 1 < argc) seed = stoull(argv[++i]);
+		else if (arg == "--check") check = true;
+		else if (arg == "--warm" && i + 1 < argc) warm = stoll(argv[++i]);
+		else if (arg == "--warm-to" && i + 1 < argc) warmto = stoi(argv[++i]);
+		else if (arg == "--repeat" && i + 1 < argc) repeat = stoi(argv[++i]);
+		else filename = arg;
+	}
+
+	Hack hack;
+	if (!hack.Load(filename)) {
+		cerr << "usage: HackEmu [--steps n] [--ram addr=value] [--print addr[-addr]] [--screen out.pbm] [--key code] [--aot out.inc] [--compiled] [--profile] [--collapsed out.txt] [--no-fuse] [--batch n [--random addr[-addr]] [--seed s] [--check]] [--warm n] [--warm-to addr] [--repeat k] <program.hack>" << endl;
+		return 1;
+	}
+	Profiler profiler;
+	bool profiling = profile || !collapsedfile.empty();
+	string mapfile = filename.substr(0, filename.rfind('.')) + ".map";
+	if (profiling && !profiler.Load(mapfile)) {
+		cerr << "--profile needs " << mapfile << " from Assembler --map" << endl;
+		return 1;
+	}
+	if (!aotfile.empty()) {
+		ofstream ofs(aotfile);
+		hack.WriteCompiled(ofs, filename);
+		return 0;
+	}
+#ifdef HACKEMU_AOT
+	if (compiled && !hack.MatchesCompiled()) {
+		cerr << filename << " is not the program " << HACKEMU_AOT << " was made from" << endl;
+		return 1;
+	}
+#else
+	if (compiled) {
+		cerr << "--compiled needs a build with -DHACKEMU_AOT='\"<file from --aot>\"'" << endl;
+		return 1;
+	}
+#endif
+	if (fuse) hack.Fuse();
+	// the boot that every run shares, before --ram and --key; one instruction at a time for
+	// --warm-to, so that it stops at the address even inside a fused sequence
+	if (warm > 0 || warmto >= 0) {
+		auto start = chrono::steady_clock::now();
+		long long n = hack.Run(warm);
+		if (warmto >= 0)
+			while (hack.PC() != warmto && hack.Run(1)) ++n;
+		double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+		cout << fixed << setprecision(2) << "warmed up to " << hack.PC() << " in " << n << " instructions, " << ms << " ms" << endl;
+	}
+	Hack::Snapshot warmed = hack.Save();
+	for (auto& [address, value] : sets) hack.Ram(address) = value;
+	hack.Ram(Hack::KBD) = key;
+
+	if (repeat > 0) {
+		if (profiling || batch > 0) {
+			cerr << "--repeat runs without --profile or --batch" << endl;
+			return 1;
+		}
+		// every run from the snapshot, which has to end in the same state as the first
+		double restoring = 0, running = 0;
+		long long n = 0, copied = 0;
+		int mismatches = 0;
+		uint64_t first = 0;
+		for (int i = 0; i < repeat; ++i) {
+			auto start = chrono::steady_clock::now();
+			copied += hack.Restore(warmed);
+			for (auto& [address, value] : sets) hack.Ram(address) = value;
+			hack.Ram(Hack::KBD) = key;
+			auto ran = chrono::steady_clock::now();
+			restoring += chrono::duration<double, micro>(ran - start).count();
+#ifdef HACKEMU_AOT
+			n += compiled ? hack.RunCompiled(steps) : hack.Run(steps);
+#else
+			n += hack.Run(steps);
+#endif
+			running += chrono::duration<double, milli>(chrono::steady_clock::now() - ran).count();
+			uint64_t state = hack.RamChecksum() ^ ((uint64_t)hack.ARegister() << 48 | (uint64_t)hack.DRegister() << 32 | (uint64_t)hack.PC() << 1 | hack.Halted());
+			if (i == 0) first = state;
+			else if (state != first && mismatches++ == 0) cout << "run " << i << " differs from the first" << endl;
+		}
+		for (auto& [first, last] : prints)
+			for (int address = first; address <= last; ++address)
+				cout << "RAM[" << address << "] = " << (int16_t)hack.Ram(address) << endl;
+		cout << fixed << setprecision(2)
+			<< repeat << " runs, " << n << " instructions, restore " << restoring / repeat << " us ("
+			<< (double)copied / repeat << " of " << warmed.pages.size() << " pages), run " << running / repeat << " ms, "
+			<< (running > 0 ? n / running / 1000 : 0) << " MIPS, " << mismatches << " mismatches" << endl;
+		return mismatches ? 2 : 0;
+	}
+
+	if (batch > 0) {
+		if (profiling || compiled || !screenfile.empty()) {
+			cerr << "--batch runs the interpreter, without --profile, --compiled or --screen" << endl;
+			return 1;
+		}
+		// splitmix64 of the seed, the instance and the address
+		auto random = [&](int instance, int address) {
+			uint64_t z = seed + 0x9e3779b97f4a7c15ULL * ((uint64_t)instance * 32768 + address + 1);
+			z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+			z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+			return (uint16_t)(z ^ (z >> 31));
+		};
+		Batch machines(hack, batch);
+		for (int i = 0; i < batch; ++i)
+			for (auto& [first, last] : randoms)
+				for (int address = first; address <= last; ++address) machines.Ram(i, address) = random(i, address);
+
+		auto start = chrono::steady_clock::now();
+		long long n = machines.Run(steps);
+		double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+		int halted = 0;
+		for (int i = 0; i < batch; ++i) {
+			halted += machines.Halted(i);
+			if (prints.empty()) continue;
+			cout << "#" << i;
+			for (auto& [first, last] : prints)
+				for (int address = first; address <= last; ++address)
+					cout << " RAM[" << address << "] = " << (int16_t)machines.Ram(i, address);
+			cout << endl;
+		}
+		cout << fixed << setprecision(2)
+			<< batch << " instances, " << halted << " halted, " << n << " instructions, " << ms << " ms, "
+			<< (ms > 0 ? n / ms / 1000 : 0) << " MIPS in all, " << (n ? 100.0 * machines.Together() / n : 0) << "% in groups (average "
+			<< (machines.GroupSteps() ? (double)machines.Together() / machines.GroupSteps() : 0) << " instances)" << endl;
+		if (!check) return 0;
+
+		// each instance again on its own Hack, which has to end in the same state
+		int mismatches = 0;
+		double alone = 0;
+		for (int i = 0; i < batch; ++i) {
+			Hack one = hack;
+			for (auto& [first, last] : randoms)
+				for (int address = first; address <= last; ++address) one.Ram(address) = random(i, address);
+			start = chrono::steady_clock::now();
+			one.Run(steps);
+			alone += chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+			bool same = one.ARegister() == machines.ARegister(i) && one.DRegister() == machines.DRegister(i)
+				&& one.PC() == machines.PC(i) && one.Halted() == machines.Halted(i);
+			for (int address = 0; address < 32768 && same; ++address) same = one.Ram(address) == machines.Ram(i, address);
+			if (!same && mismatches++ == 0) cout << "instance " << i << " differs from running it alone" << endl;
+		}
+		cout << "alone " << alone << " ms, " << (alone > 0 ? n / alone / 1000 : 0) << " MIPS, " << mismatches << " mismatches" << endl;
+		return mismatches ? 2 : 0;
+	}
+
+	auto start = chrono::steady_clock::now();
+#ifdef HACKEMU_AOT
+	long long n = profiling ? profiler.Run(hack, steps) : compiled ? hack.RunCompiled(steps) : hack.Run(steps);
+#else
+	long long n = profiling ? profiler.Run(hack, steps) : hack.Run(steps);
+#endif
+	double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+	for (auto& [first, last] : prints)
+		for (int address = first; address <= last; ++address)
+			cout << "RAM[" << address << "] = " << (int16_t)hack.Ram(address) << endl;
+	if (!screenfile.empty()) hack.WriteScreen(screenfile);
+
+	cout << fixed << setprecision(2)
+		<< (hack.Halted() ? "halted" : "stopped") << " at " << hack.PC() << " after " << n << " instructions, "
+		<< ms << " ms, " << (ms > 0 ? n / ms / 1000 : 0) << " MIPS";
+	if (hack.Fused()) cout << " (" << hack.Fused() << " fused sequences)";
+	cout << endl;
+	if (profile) profiler.Print(cout);
+	if (!collapsedfile.empty()) {
+		ofstream ofs(collapsedfile);
+		profiler.WriteCollapsed(ofs);
+	}
+	return 0;
+}
+#endif
@@ -0,0 +1,68 @@
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <algorithm>
+#include <string>
+#include <regex>
+#include <bitset>
+#include <vector>
+#include <map>
+#include <cstdint>
+#include <iomanip>
+#include <chrono>
+#include <stdexcept>
+#include "../06/Stats.h"
+
+#define NO_MAIN
+namespace assembler {
+#include "../06/Assembler.cpp"
+}
+#undef NO_MAIN
+
+using namespace std;
+
+namespace as = assembler;
+
+int main(int argc, char** argv) {
+	string output;
+	vector<string> inputs;
+	for (int i = 1; i < argc; ++i) {
+		string arg = argv[i];
+		if (arg == "-o" && i + 1 < argc) output = argv[++i];
+		else inputs.push_back(arg);
+	}
+	if (output.empty() || inputs.empty()) {
+		cerr << "usage: HackLink -o <program.hack> <object.hobj|source.asm>..." << endl;
+		return 1;
+	}
+
+	Stopwatch sw;
+	try {
+		int assembled = 0, reused = 0, variablecount = 0;
+		vector<as::Object> objects;
+		for (auto& input : inputs) {
+			bool fresh;
+			objects.push_back(as::LoadObject(input, fresh));
+			++(fresh ? assembled : reused);
+		}
+		double load = sw.Lap();
+
+		vector<uint16_t> words = as::Link(objects, variablecount);
+		double link = sw.Lap();
+
+		ofstream ofs(output);
+		for (uint16_t word : words) ofs << as::Binary(word) << '\n';
+		ofs.close();
+		double write = sw.Lap();
+
+		cout << fixed << setprecision(2)
+			<< "load  " << load << " ms (" << assembled << " assembled, " << reused << " reused)" << endl
+			<< "link  " << link << " ms (" << words.size() << " words, " << variablecount << " variables)" << endl
+			<< "write " << write << " ms" << endl;
+	} catch (exception& e) {
+		cerr << "HackLink: " << e.what() << endl;
+		return 1;
+	}
+
+	return 0;
+}
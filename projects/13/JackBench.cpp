@@ -0,0 +1,134 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <utility>
+#include <tuple>
+#include <iomanip>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <array>
+#include <chrono>
+#include <stdexcept>
+#include <mutex>
+#include <condition_variable>
+#include <queue>
+#include <cstdlib>
+#include <new>
+#include <unordered_set>
+#include <string_view>
+#include <cstring>
+#include "../06/Stats.h"
+
+#define NO_MAIN
+namespace jackanalyzer {
+#include "../11/JackAnalyzer.cpp"
+}
+#undef NO_MAIN
+
+using namespace std;
+
+namespace ja = jackanalyzer;
+
+// every heap allocation in the process goes through here, so compiles can be measured
+atomic<long long> allocations(0), allocatedbytes(0);
+
+void* operator new(size_t size) {
+	allocations.fetch_add(1, memory_order_relaxed);
+	allocatedbytes.fetch_add(size, memory_order_relaxed);
+	if (void* p = malloc(size ? size : 1)) return p;
+	throw bad_alloc();
+}
+
+void operator delete(void* p) noexcept { free(p); }
+
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+struct Allocations {
+	long long count, bytes;
+};
+
+Allocations AllocationsNow() {
+	return { allocations.load(memory_order_relaxed), allocatedbytes.load(memory_order_relaxed) };
+}
+
+// a class of about `lines` lines of ordinary statements
+void WriteSyntheticClass(string filename, int lines) {
+	ofstream ofs(filename);
+	ofs << "class Big {" << '\n'
+		<< "  field int x, y;" << '\n'
+		<< "  field Array a;" << '\n';
+	int written = 3, f = 0;
+	while (written < lines) {
+		ofs << "  method int f" << f++ << "(int n, int m) {" << '\n'
+			<< "    var int i, s;" << '\n'
+			<< "    let i = 0;" << '\n';
+		for (int k = 0; k < 30; ++k) {
+			ofs << "    while (i < n) {" << '\n'
+				<< "      let s = s + (a[i] * m) - (x / 3);" << '\n'
+				<< "      let a[i + 1] = s & 255;" << '\n'
+				<< "      if (s > y) { let y = s; } else { do Output.printString(\"small\"); }" << '\n'
+				<< "      let i = i + 1;" << '\n'
+				<< "    }" << '\n';
+		}
+		ofs << "    return s;" << '\n'
+			<< "  }" << '\n';
+		written += 3 + 30 * 6 + 2;
+	}
+	ofs << "}" << '\n';
+}
+
+double Compile(string filename, ja::Options options, vector<ja::VMCommand>& commands,
+	shared_ptr<ja::StringPool>& names, Allocations& used) {
+	Allocations before = AllocationsNow();
+	auto start = chrono::steady_clock::now();
+	ja::CompilationEngine ce(filename, "", options);
+	double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+	Allocations after = AllocationsNow();
+	used = { after.count - before.count, after.bytes - before.bytes };
+	commands = ce.Commands();
+	names = ce.Names();
+	return ms;
+}
+
+bool Same(const vector<ja::VMCommand>& a, const vector<ja::VMCommand>& b) {
+	if (a.size() != b.size()) return false;
+	for (size_t i = 0; i < a.size(); ++i) {
+		if (a[i].op != b[i].op || a[i].segment != b[i].segment || a[i].command != b[i].command ||
+			a[i].name != b[i].name || a[i].index != b[i].index)
+			return false;
+	}
+	return true;
+}
+
+int main(int argc, char** argv) {
+	int lines = argc > 1 ? stoi(argv[1]) : 1000000;
+	string filename = (filesystem::temp_directory_path() / "Big.jack").string();
+	WriteSyntheticClass(filename, lines);
+
+	ja::Options single, pipelined;
+	pipelined.pipeline = true;
+
+	vector<ja::VMCommand> expected, actual;
+	shared_ptr<ja::StringPool> names1, names2;
+	Allocations used1, used2;
+	double ms1 = Compile(filename, single, expected, names1, used1);
+	double ms2 = Compile(filename, pipelined, actual, names2, used2);
+
+	cout << fixed << setprecision(1)
+		<< lines << " lines, " << expected.size() << " VM commands" << endl
+		<< "single thread " << ms1 << " ms, " << used1.count << " allocations (" << used1.bytes << " bytes)" << endl
+		<< "pipelined     " << ms2 << " ms, " << used2.count << " allocations (" << used2.bytes << " bytes)" << endl
+		<< (Same(expected, actual) ? "outputs match" : "OUTPUTS DIFFER") << endl;
+
+	filesystem::remove(filename);
+	return Same(expected, actual) ? 0 : 1;
+}
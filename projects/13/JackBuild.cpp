@@ -0,0 +1,188 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+#include <algorithm>
+#include <string>
+#include <regex>
+#include <bitset>
+#include <vector>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <string_view>
+#include <cstring>
+#include <utility>
+#include <tuple>
+#include <iomanip>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <array>
+#include <chrono>
+#include <stdexcept>
+#include <mutex>
+#include <condition_variable>
+#include <queue>
+#include "../06/Stats.h"
+
+// the three stages are linked in as they are, each in its own namespace
+#define NO_MAIN
+namespace assembler {
+#include "../06/Assembler.cpp"
+}
+namespace vmtranslator {
+#include "../08/VMtranslator.cpp"
+}
+namespace jackanalyzer {
+#include "../11/JackAnalyzer.cpp"
+}
+#undef NO_MAIN
+
+using namespace std;
+
+namespace ja = jackanalyzer;
+namespace vt = vmtranslator;
+namespace as = assembler;
+namespace fs = filesystem;
+
+// the compiler's VM records go straight into the code writer, nothing is reparsed
+void Translate(vt::CodeWriter& cw, const vector<ja::VMCommand>& commands) {
+	for (auto& c : commands) {
+		switch (c.op) {
+		case ja::VMOp::PUSH:
+			cw.WritePushPop(vt::Command::C_PUSH, ja::VMWriter::Segtostr(c.segment), c.index);
+			break;
+		case ja::VMOp::POP:
+			cw.WritePushPop(vt::Command::C_POP, ja::VMWriter::Segtostr(c.segment), c.index);
+			break;
+		case ja::VMOp::ARITHMETIC:
+			cw.WriteArithmetic(ja::VMWriter::Comtostr(c.command));
+			break;
+		case ja::VMOp::LABEL:
+			cw.WriteLabel(string(c.name));
+			break;
+		case ja::VMOp::GOTO:
+			cw.WriteGoto(string(c.name));
+			break;
+		case ja::VMOp::IF:
+			cw.WriteIf(string(c.name));
+			break;
+		case ja::VMOp::CALL:
+			cw.WriteCall(string(c.name), c.index);
+			break;
+		case ja::VMOp::FUNCTION:
+			cw.WriteFunction(string(c.name), c.index);
+			break;
+		case ja::VMOp::RETURN:
+			cw.WriteReturn();
+			break;
+		case ja::VMOp::RETURN_VOID:
+			cw.WriteReturn(false);
+			break;
+		}
+	}
+}
+
+int main(int argc, char** argv) {
+	ja::Options options;
+	string source;
+	// 11/OS/OS.hobj, found from the executable as JackAnalyzer used to find its OS directory
+	fs::path library = fs::path(argv[0]).parent_path() / ".." / "11" / "OS" / "OS.hobj";
+	bool keep = false, compact = false;
+	for (int i = 1; i < argc; ++i) {
+		string arg = argv[i];
+		if (arg == "--keep") keep = true;
+		else if (arg == "--os" && i + 1 < argc) library = argv[++i];
+		else if (arg == "--no-os") library.clear();
+		else if (arg == "--pool-strings") options.poolstrings = true;
+		else if (arg == "--whole-program") options.wholeprogram = true;
+		else if (arg == "--compact") compact = true;
+		else source = arg;
+	}
+
+	fs::path dir = fs::absolute(source);
+	if (!fs::is_directory(dir)) {
+		cerr << "usage: JackBuild [--keep] [--os OS.hobj|OS.asm] [--no-os] [--pool-strings] [--whole-program] [--compact] <dir>" << endl;
+		return 1;
+	}
+	if (source.back() == '/') dir = dir.parent_path();
+	string name = (dir / dir.filename()).string();
+
+	vector<string> files;
+	for (auto& p : fs::directory_iterator(dir))
+		if (p.path().extension() == ".jack")
+			files.push_back(p.path().string());
+	sort(files.begin(), files.end());
+
+	Stopwatch sw;
+	ja::Program program;
+	for (auto& file : files)
+		program.classnames.push_back(fs::path(file).stem().string());
+	if (options.wholeprogram) program.voids = ja::JackAnalyzer::VoidSubroutines(files);
+
+	vector<vector<ja::VMCommand> > classes;
+	vector<shared_ptr<ja::StringPool> > names;
+	try {
+		for (auto& file : files) {
+			ja::CompilationEngine ce(file, keep ? file.substr(0, file.size() - 5) : "", options, program);
+			classes.push_back(ce.Commands());
+			names.push_back(ce.Names());
+		}
+	} catch (exception& e) {
+		cerr << "JackBuild: " << e.what() << endl;
+		return 1;
+	}
+	double compile = sw.Lap();
+
+	ostringstream asmout;
+	vt::CodeWriter cw(asmout);
+	if (compact) cw.Compact();
+	cw.WriteInit();
+	for (size_t i = 0; i < classes.size(); ++i) {
+		cw.SetFileName(program.classnames[i] + ".vm");
+		Translate(cw, classes[i]);
+	}
+	cw.close();
+	string program_asm = asmout.str();
+	if (keep) ofstream(name + ".asm") << program_asm;
+	double translate = sw.Lap();
+
+	// the program is an object, linked with the OS or alone (which also checks that it fits in ROM)
+	as::SymbolTable st;
+	istringstream labels(program_asm);
+	auto labeladdresses = as::DefineLabels(labels, st);
+	istringstream instructions(program_asm);
+	vector<as::Object> objects;
+	objects.push_back(as::EncodeObject(instructions, labeladdresses));
+	double assemble = sw.Lap();
+
+	vector<uint16_t> words;
+	int variablecount = 0;
+	try {
+		bool assembled;
+		if (!library.empty()) objects.push_back(as::LoadObject(library.string(), assembled));
+		words = as::Link(objects, variablecount);
+	} catch (exception& e) {
+		cerr << "JackBuild: " << e.what() << endl;
+		return 1;
+	}
+	double link = sw.Lap();
+
+	ofstream ofs(name + ".hack");
+	for (uint16_t word : words) ofs << as::Binary(word) << '\n';
+	ofs.close();
+	double write = sw.Lap();
+
+	cout << fixed << setprecision(2)
+		<< "compile   " << compile << " ms (" << files.size() << " classes)" << endl
+		<< "translate " << translate << " ms" << endl
+		<< "assemble  " << assemble << " ms" << endl
+		<< "link      " << link << " ms (" << words.size() << " words" << (library.empty() ? ", no OS" : "") << ")" << endl
+		<< "write     " << write << " ms" << endl
+		<< "total     " << compile + translate + assemble + link + write << " ms" << endl;
+
+	return 0;
+}
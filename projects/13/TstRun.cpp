@@ -0,0 +1,674 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+#include <algorithm>
+#include <string>
+#include <regex>
+#include <bitset>
+#include <vector>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <iomanip>
+#include <cstdint>
+#include <climits>
+#include <cctype>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <array>
+#include <chrono>
+#include <stdexcept>
+#include <type_traits>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+#include "../06/Stats.h"
+
+// the assembler for .asm programs, the gate simulator for chips and the two emulators
+#define NO_MAIN
+namespace assembler {
+#include "../06/Assembler.cpp"
+}
+namespace hdlsim {
+#include "HDLSim.cpp"
+}
+namespace hackemu {
+#include "HackEmu.cpp"
+}
+namespace vmrun {
+#include "VMRun.cpp"
+}
+#undef NO_MAIN
+
+using namespace std;
+
+namespace fs = filesystem;
+namespace as = assembler;
+
+// an output line that differs from its line in the .cmp file
+struct Mismatch : runtime_error {
+	using runtime_error::runtime_error;
+};
+
+// a script that cannot run unattended: it waits for a key or runs until stopped by hand
+struct Skip : runtime_error {
+	using runtime_error::runtime_error;
+};
+
+// one command of a script as its words; repeat and while have a body
+struct Statement {
+	vector<string> words;
+	vector<Statement> body;
+	int line = 0;
+};
+
+// commands end at ',' or ';', a body is in braces. Comments are // and /* */, a quoted
+// string (the text of echo) is one word
+class ScriptParser {
+private:
+	struct Token {
+		string text;
+		int line;
+	};
+	vector<Token> tokens;
+	size_t pos = 0;
+
+	void Tokenize(const string& text) {
+		int line = 1;
+		string word;
+		auto flush = [&]() {
+			if (!word.empty()) tokens.push_back({ word, line });
+			word.clear();
+		};
+		for (size_t i = 0; i < text.size(); ++i) {
+			char c = text[i];
+			if (c == '/' && i + 1 < text.size() && text[i + 1] == '/') {
+				flush();
+				while (i < text.size() && text[i] != '\n') ++i;
+				--i;
+			} else if (c == '/' && i + 1 < text.size() && text[i + 1] == '*') {
+				flush();
+				size_t end = text.find("*/", i + 2);
+				if (end == string::npos) throw runtime_error("line " + to_string(line) + ": comment without */");
+				line += (int)count(text.begin() + i, text.begin() + end, '\n');
+				i = end + 1;
+			} else if (c == '"') {
+				flush();
+				size_t end = text.find('"', i + 1);
+				if (end == string::npos) throw runtime_error("line " + to_string(line) + ": string without closing quote");
+				tokens.push_back({ text.substr(i, end + 1 - i), line });
+				line += (int)count(text.begin() + i, text.begin() + end, '\n');
+				i = end;
+			} else if (c == ',' || c == ';' || c == '{' || c == '}') {
+				flush();
+				tokens.push_back({ string(1, c), line });
+			} else if (isspace((unsigned char)c)) {
+				flush();
+				if (c == '\n') ++line;
+			} else word += c;
+		}
+		flush();
+	}
+
+	vector<Statement> Block(bool nested) {
+		vector<Statement> block;
+		Statement s;
+		while (pos < tokens.size()) {
+			const Token& t = tokens[pos++];
+			if (t.text == "," || t.text == ";") {
+				if (!s.words.empty()) block.push_back(move(s));
+				s = Statement();
+			} else if (t.text == "{") {
+				if (s.words.empty() || (s.words[0] != "repeat" && s.words[0] != "while"))
+					throw runtime_error("line " + to_string(t.line) + ": { without repeat or while");
+				s.body = Block(true);
+				block.push_back(move(s));
+				s = Statement();
+			} else if (t.text == "}") {
+				if (!nested) throw runtime_error("line " + to_string(t.line) + ": } without {");
+				if (!s.words.empty()) block.push_back(move(s));
+				return block;
+			} else {
+				if (s.words.empty()) s.line = t.line;
+				s.words.push_back(t.text);
+			}
+		}
+		if (nested) throw runtime_error("{ without }");
+		if (!s.words.empty()) block.push_back(move(s));
+		return block;
+	}
+public:
+	vector<Statement> Parse(const string& filename) {
+		ifstream ifs(filename);
+		if (!ifs) throw runtime_error("cannot open " + filename);
+		stringstream ss;
+		ss << ifs.rdbuf();
+		tokens.clear();
+		pos = 0;
+		Tokenize(ss.str());
+		return Block(false);
+	}
+};
+
+// "RAM[5]" is RAM and 5, "PC[]" is PC and -1; false for a name without brackets
+bool Indexed(const string& name, string& base, int& index) {
+	size_t open = name.find('[');
+	if (open == string::npos || name.back() != ']') return false;
+	base = name.substr(0, open);
+	string inside = name.substr(open + 1, name.size() - open - 2);
+	index = inside.empty() ? -1 : stoi(inside);
+	return true;
+}
+
+// what a script drives: a chip, a program on the CPU emulator or VM code on the VM emulator.
+// time counts the clock cycles, with a + between tick and tock
+class Target {
+protected:
+	long long time = 0;
+	bool ticked = false;
+public:
+	virtual ~Target() {}
+	// false if there is no such variable; width is in bits
+	virtual bool Get(const string& name, int& value, int& width) = 0;
+	virtual void Set(const string& name, int value) = 0;
+	// eval, tick, tock, ticktock or vmstep n times; false if the target has no such command
+	virtual bool Run(const string& command, long long n) = 0;
+	// "ROM32K load Max.hack"
+	virtual void LoadMemory(const string& name, const string& file) {
+		throw runtime_error("no memory " + name + " to load " + file + " into");
+	}
+	string Time() const {
+		return to_string(time) + (ticked ? "+" : "");
+	}
+};
+
+class HdlTarget : public Target {
+private:
+	hdlsim::Netlist netlist;
+	unique_ptr<hdlsim::Simulator<uint64_t> > sim;
+	map<int, int> latched; // DFF output net -> DFF
+
+	int Bits(const vector<int>& nets) const {
+		int v = 0;
+		for (size_t b = 0; b < nets.size(); ++b) v |= (int)(sim->Value(nets[b]) & 1) << b;
+		return v;
+	}
+	// the word of "RAM16K[3]", null if name is no memory word
+	uint16_t* Word(const string& name) {
+		string base;
+		int index;
+		if (!Indexed(name, base, index) || index < 0) return nullptr;
+		int m = netlist.FindMemory(base);
+		if (m < 0) return nullptr;
+		if (index >= netlist.memories[m].words) throw runtime_error(name + " is past the end of " + base);
+		return sim->Memory(m) + index;
+	}
+public:
+	explicit HdlTarget(const string& file) {
+		netlist.Elaborate(file);
+		sim = make_unique<hdlsim::Simulator<uint64_t> >(netlist, 1);
+		sim->Eval();
+		for (size_t i = 0; i < netlist.flops.size(); ++i) latched[netlist.flops[i].out] = (int)i;
+	}
+	bool Get(const string& name, int& value, int& width) override {
+		if (uint16_t* word = Word(name)) {
+			value = *word;
+			width = 16;
+			return true;
+		}
+		for (auto* ports : { &netlist.inputs, &netlist.outputs })
+			for (auto& p : *ports)
+				if (p.name == name) {
+					value = Bits(p.nets);
+					width = (int)p.nets.size();
+					return true;
+				}
+		// ARegister[] and ARegister[0] are both the register's value, which is what its DFFs
+		// took at the last tick
+		string base;
+		int index;
+		if (!Indexed(name, base, index) || !netlist.parts.count(base)) return false;
+		auto& nets = netlist.parts[base];
+		value = 0;
+		for (size_t b = 0; b < nets.size(); ++b) {
+			auto flop = latched.find(nets[b]);
+			value |= (int)((flop != latched.end() ? sim->Latched(flop->second) : sim->Value(nets[b])) & 1) << b;
+		}
+		width = (int)nets.size();
+		return true;
+	}
+	void Set(const string& name, int value) override {
+		if (uint16_t* word = Word(name)) {
+			*word = (uint16_t)value;
+			return;
+		}
+		int input = netlist.Input(name);
+		if (input < 0) throw runtime_error(netlist.name + " has no input " + name);
+		sim->Set(input, 0, value);
+	}
+	bool Run(const string& command, long long n) override {
+		if (command == "eval") {
+			for (long long i = 0; i < n; ++i) sim->Eval();
+		} else if (command == "tick") {
+			for (long long i = 0; i < n; ++i) sim->Tick();
+			ticked = true;
+		} else if (command == "tock") {
+			for (long long i = 0; i < n; ++i) sim->Tock();
+			time += n;
+			ticked = false;
+		} else if (command == "ticktock") {
+			for (long long i = 0; i < n; ++i) sim->Tick(), sim->Tock();
+			time += n;
+			ticked = false;
+		} else return false;
+		return true;
+	}
+	void LoadMemory(const string& name, const string& file) override {
+		int m = netlist.FindMemory(name);
+		ifstream ifs(file);
+		if (m < 0) Target::LoadMemory(name, file);
+		if (!ifs) throw runtime_error("cannot open " + file);
+		string line;
+		for (int address = 0; address < netlist.memories[m].words && getline(ifs, line); )
+			if (line.size() >= 16) sim->Memory(m)[address++] = (uint16_t)stoul(line.substr(0, 16), nullptr, 2);
+	}
+};
+
+class CpuTarget : public Target {
+private:
+	hackemu::Hack hack;
+public:
+	// a .asm is assembled first, as the CPU emulator does
+	explicit CpuTarget(const string& file) {
+		if (fs::path(file).extension() == ".hack") {
+			if (!hack.Load(file)) throw runtime_error("cannot open " + file);
+		} else {
+			ifstream labels(file), instructions(file);
+			if (!labels) throw runtime_error("cannot open " + file);
+			as::SymbolTable st;
+			as::DefineLabels(labels, st);
+			hack.Load(as::Encode(instructions, st));
+		}
+		hack.Fuse();
+	}
+	bool Get(const string& name, int& value, int& width) override {
+		string base;
+		int index;
+		width = 16;
+		if (name == "A") value = hack.ARegister();
+		else if (name == "D") value = hack.DRegister();
+		else if (name == "PC") value = hack.PC(), width = 15;
+		else if (Indexed(name, base, index) && base == "RAM" && index >= 0) value = hack.Ram(index);
+		else return false;
+		return true;
+	}
+	void Set(const string& name, int value) override {
+		string base;
+		int index;
+		if (name == "A") hack.ARegister() = value;
+		else if (name == "D") hack.DRegister() = value;
+		else if (name == "PC") hack.Jump(value);
+		else if (Indexed(name, base, index) && base == "RAM" && index >= 0) hack.Ram(index) = value;
+		else throw runtime_error("the CPU emulator has no " + name);
+	}
+	bool Run(const string& command, long long n) override {
+		if (command != "ticktock") return false;
+		hack.Run(n);
+		time += n;
+		return true;
+	}
+};
+
+class VmTarget : public Target {
+private:
+	vmrun::VM vm;
+
+	// sp, local, argument, this and that are the pointers, local[2] and the like what they point to
+	int Address(const string& name) {
+		static const map<string, int> pointers = { { "sp", 0 }, { "local", 1 }, { "argument", 2 }, { "this", 3 }, { "that", 4 } };
+		auto it = pointers.find(name);
+		if (it != pointers.end()) return it->second;
+		string base;
+		int index;
+		if (!Indexed(name, base, index) || index < 0) return -1;
+		if (base == "RAM") return index;
+		if (base == "temp") return 5 + index;
+		if (base == "pointer") return 3 + index;
+		it = pointers.find(base);
+		if (it != pointers.end() && it->second > 0) return vm.Ram(it->second) + index;
+		return -1;
+	}
+public:
+	// with Sys.vm it starts at Sys.init, without the call the bootstrap makes
+	explicit VmTarget(const string& path) {
+		vm.Load(path, "", false);
+		fs::path p(path);
+		if (fs::is_directory(p) ? fs::exists(p / "Sys.vm") : p.stem() == "Sys") vm.Enter("Sys.init");
+	}
+	bool Get(const string& name, int& value, int& width) override {
+		int address = Address(name);
+		if (address < 0) return false;
+		value = vm.Ram(address);
+		width = 16;
+		return true;
+	}
+	void Set(const string& name, int value) override {
+		int address = Address(name);
+		if (address < 0) throw runtime_error("the VM emulator has no " + name);
+		vm.Ram(address) = value;
+	}
+	bool Run(const string& command, long long n) override {
+		if (command != "vmstep") return false;
+		vm.Run(n);
+		return true;
+	}
+};
+
+// %B0101, %XFF, %D-3 or a plain decimal
+int Number(const string& s) {
+	try {
+		size_t used = 0;
+		int v;
+		if (s.size() > 2 && s[0] == '%') {
+			int base = s[1] == 'B' ? 2 : s[1] == 'X' ? 16 : s[1] == 'D' ? 10 : 0;
+			if (!base) throw invalid_argument(s);
+			v = stoi(s.substr(2), &used, base);
+			used += 2;
+		} else v = stoi(s, &used);
+		if (used != s.size()) throw invalid_argument(s);
+		return v;
+	} catch (const logic_error&) {
+		throw runtime_error("not a value: " + s);
+	}
+}
+
+// runs one script, comparing each output line with its line in the .cmp file as it goes
+class ScriptRunner {
+private:
+	// name%Dp.w.q: p spaces, the value in w characters, q spaces
+	struct Column {
+		string name;
+		char format;
+		int p, w, q;
+	};
+	static const long long WHILE_LIMIT = 1000000;
+
+	fs::path dir;
+	unique_ptr<Target> target;
+	vector<Column> columns;
+	vector<string> expected; // the lines of the .cmp file
+	string cmpfile, outfile;
+	vector<string> out;
+	int line = 0;            // of the command running
+
+	Target& Loaded() {
+		if (!target) throw runtime_error("nothing is loaded");
+		return *target;
+	}
+
+	void Load(const string& name) {
+		fs::path path = name.empty() ? dir : dir / name;
+		string ext = path.extension().string();
+		if (!fs::exists(path) && ext == ".asm") throw Skip("no " + path.string() + ", translate the .vm files first");
+		if (!fs::exists(path)) throw runtime_error("no " + path.string());
+		if (ext == ".hdl") target = make_unique<HdlTarget>(path.string());
+		else if (ext == ".asm" || ext == ".hack") target = make_unique<CpuTarget>(path.string());
+		else if (ext == ".vm") target = make_unique<VmTarget>(path.string());
+		else if (fs::is_directory(path)) {
+			bool vm = false;
+			for (auto& p : fs::directory_iterator(path)) vm = vm || p.path().extension() == ".vm";
+			if (!vm) throw Skip("no .vm files in " + path.string() + ", compile the .jack files first");
+			target = make_unique<VmTarget>(path.string());
+		} else throw runtime_error("cannot load " + path.string());
+	}
+
+	void OutputList(const vector<string>& words) {
+		columns.clear();
+		for (size_t i = 1; i < words.size(); ++i) {
+			Column c;
+			size_t percent = words[i].find('%');
+			c.name = words[i].substr(0, percent);
+			if (percent == string::npos) {
+				// the default is the value in binary, as wide as the variable
+				int value, width;
+				if (!Loaded().Get(c.name, value, width)) throw runtime_error("no variable " + c.name);
+				c.format = 'B', c.p = 1, c.w = width, c.q = 1;
+			} else {
+				char dot;
+				istringstream is(words[i].substr(percent + 2));
+				c.format = percent + 1 < words[i].size() ? words[i][percent + 1] : '?';
+				if (string("BDXS").find(c.format) == string::npos || !(is >> c.p >> dot >> c.w >> dot >> c.q))
+					throw runtime_error("bad column " + words[i]);
+			}
+			columns.push_back(c);
+		}
+		string header = "|";
+		for (auto& c : columns) {
+			int total = c.p + c.w + c.q;
+			string name = c.name.substr(0, total);
+			int left = (total - (int)name.size()) / 2;
+			header += string(left, ' ') + name + string(total - left - name.size(), ' ') + "|";
+		}
+		Output(header);
+	}
+
+	string Cell(const Column& c) {
+		string text;
+		int value = 0, width = 16;
+		bool isvalue = true;
+		if (c.name == "time" && !Loaded().Get(c.name, value, width)) text = Loaded().Time(), isvalue = false;
+		else if (!Loaded().Get(c.name, value, width)) throw runtime_error("no variable " + c.name);
+		if (isvalue) {
+			unsigned bits = (unsigned)value & ((1u << width) - 1);
+			int number = width == 16 ? (int16_t)bits : (int)bits;
+			ostringstream os;
+			if (c.format == 'B') for (int b = c.w - 1; b >= 0; --b) os << (bits >> b & 1);
+			else if (c.format == 'X') os << uppercase << hex << setw(c.w) << setfill('0') << bits;
+			else if (c.format == 'D') os << setw(c.w) << number;
+			else os << number;
+			text = os.str();
+		}
+		if (c.format == 'S' && (int)text.size() < c.w) text += string(c.w - text.size(), ' ');
+		return string(c.p, ' ') + text + string(c.q, ' ');
+	}
+
+	// '*' in the .cmp file stands for any character
+	static bool Matches(string expect, string actual) {
+		auto trim = [](string& s) { while (!s.empty() && isspace((unsigned char)s.back())) s.pop_back(); };
+		trim(expect);
+		trim(actual);
+		if (expect.size() != actual.size()) return false;
+		for (size_t i = 0; i < expect.size(); ++i)
+			if (expect[i] != '*' && expect[i] != actual[i]) return false;
+		return true;
+	}
+
+	void Output(const string& text) {
+		out.push_back(text);
+		if (cmpfile.empty()) return;
+		size_t i = out.size() - 1;
+		if (i >= expected.size() || !Matches(expected[i], text))
+			throw Mismatch("line " + to_string(i + 1) + " of " + cmpfile + ": expected " + (i < expected.size() ? expected[i] : "nothing")
+				+ ", got " + text);
+	}
+
+	int Operand(const string& s) {
+		int value, width;
+		if (target && target->Get(s, value, width)) return width == 16 ? (int16_t)value : value;
+		return Number(s);
+	}
+
+	bool Condition(const vector<string>& words) {
+		if (words.size() != 4) throw runtime_error("while needs a condition like out <> 75");
+		int lhs = Operand(words[1]), rhs = Operand(words[3]);
+		const string& op = words[2];
+		if (op == "=") return lhs == rhs;
+		if (op == "<>") return lhs != rhs;
+		if (op == "<") return lhs < rhs;
+		if (op == ">") return lhs > rhs;
+		if (op == "<=") return lhs <= rhs;
+		if (op == ">=") return lhs >= rhs;
+		throw runtime_error("no operator " + op);
+	}
+
+	void Execute(const Statement& s) {
+		line = s.line;
+		const string& c = s.words[0];
+		auto arg = [&](size_t i) -> const string& {
+			if (i >= s.words.size()) throw runtime_error(c + " is missing an argument");
+			return s.words[i];
+		};
+		if (c == "load") Load(s.words.size() > 1 ? s.words[1] : "");
+		else if (c == "output-file") outfile = arg(1);
+		else if (c == "compare-to") {
+			ifstream ifs(dir / arg(1));
+			if (!ifs) throw runtime_error("cannot open " + (dir / arg(1)).string());
+			cmpfile = arg(1);
+			expected.clear();
+			for (string text; getline(ifs, text); ) expected.push_back(text);
+		} else if (c == "output-list") OutputList(s.words);
+		else if (c == "output") {
+			string row = "|";
+			for (auto& column : columns) row += Cell(column) + "|";
+			Output(row);
+		} else if (c == "set") Loaded().Set(arg(1), Number(arg(2)));
+		else if (c == "repeat") {
+			if (s.words.size() == 1) throw Skip("line " + to_string(s.line) + ": repeat without a count runs until stopped by hand");
+			long long n = Number(arg(1));
+			// "repeat n { ticktock; }" is one run of n steps
+			if (s.body.size() == 1 && s.body[0].words.size() == 1 && target && target->Run(s.body[0].words[0], n)) return;
+			for (long long i = 0; i < n; ++i)
+				for (auto& b : s.body) Execute(b);
+		} else if (c == "while") {
+			for (long long i = 0; Condition(s.words); ++i) {
+				if (i == WHILE_LIMIT) throw Skip("line " + to_string(s.line) + ": the while loop waits for input");
+				for (auto& b : s.body) Execute(b);
+			}
+		} else if (c == "echo" || c == "clear-echo" || c == "breakpoint" || c == "clear-breakpoints") return;
+		else if (s.words.size() == 3 && s.words[1] == "load") Loaded().LoadMemory(c, (dir / s.words[2]).string());
+		else if (s.words.size() > 1 || !Loaded().Run(c, 1)) throw runtime_error("unknown command " + c);
+	}
+public:
+	// "", or the message of a mismatch, a Skip or an error. The .out file is written if out is set
+	void Run(const string& filename, bool writeout) {
+		dir = fs::path(filename).parent_path();
+		vector<Statement> script = ScriptParser().Parse(filename);
+		try {
+			for (auto& s : script) Execute(s);
+			size_t lines = expected.size();
+			while (lines > 0 && expected[lines - 1].find_first_not_of(" \t\r") == string::npos) --lines;
+			if (out.size() < lines)
+				throw Mismatch("only " + to_string(out.size()) + " of the " + to_string(lines) + " lines of " + cmpfile);
+		} catch (const Mismatch&) {
+			if (writeout) WriteOut();
+			throw;
+		} catch (const Skip&) {
+			throw;
+		} catch (const exception& e) {
+			throw runtime_error("line " + to_string(line) + ": " + e.what());
+		}
+		if (writeout) WriteOut();
+	}
+
+	void WriteOut() {
+		if (outfile.empty()) return;
+		ofstream ofs(dir / outfile);
+		for (auto& text : out) ofs << text << endl;
+	}
+};
+
+struct Result {
+	string status = "PASS", message;
+	double ms = 0;
+};
+
+Result RunScript(const string& filename, bool writeout) {
+	Result r;
+	auto start = chrono::steady_clock::now();
+	try {
+		ScriptRunner().Run(filename, writeout);
+	} catch (const Mismatch& e) {
+		r.status = "FAIL", r.message = e.what();
+	} catch (const Skip& e) {
+		r.status = "SKIP", r.message = e.what();
+	} catch (const exception& e) {
+		r.status = "ERROR", r.message = e.what();
+	}
+	r.ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+	return r;
+}
+
+int main(int argc, char** argv) {
+	vector<string> paths;
+	unsigned jobs = max(1u, thread::hardware_concurrency());
+	bool writeout = false;
+	for (int i = 1; i < argc; ++i) {
+		string arg = argv[i];
+		if (arg == "--jobs" && i + 1 < argc) jobs = max(1, stoi(argv[++i]));
+		else if (arg == "--out") writeout = true;
+		else if (arg.size() > 1 && arg[0] == '-') {
+			cerr << "usage: TstRun [--jobs n] [--out] [script.tst | dir]..." << endl;
+			return 1;
+		} else paths.push_back(arg);
+	}
+	if (paths.empty()) paths.push_back(".");
+
+	vector<string> scripts;
+	try {
+		for (auto& path : paths) {
+			if (fs::is_directory(path)) {
+				for (auto& p : fs::recursive_directory_iterator(path))
+					if (p.path().extension() == ".tst") scripts.push_back(p.path().string());
+			} else if (fs::exists(path)) scripts.push_back(path);
+			else throw runtime_error("no " + path);
+		}
+	} catch (const exception& e) {
+		cerr << "TstRun: " << e.what() << endl;
+		return 1;
+	}
+	sort(scripts.begin(), scripts.end());
+	scripts.erase(unique(scripts.begin(), scripts.end()), scripts.end());
+	if (scripts.empty()) {
+		cerr << "TstRun: no .tst files" << endl;
+		return 1;
+	}
+
+	// every script on its own, as many at once as there are cores. The results are printed in
+	// order as soon as all the scripts before them are done
+	vector<Result> results(scripts.size());
+	vector<char> done(scripts.size(), 0);
+	atomic<size_t> next(0);
+	mutex m;
+	size_t printed = 0;
+	auto start = chrono::steady_clock::now();
+	auto work = [&]() {
+		for (size_t i; (i = next++) < scripts.size(); ) {
+			Result r = RunScript(scripts[i], writeout);
+			lock_guard<mutex> lock(m);
+			results[i] = r;
+			done[i] = 1;
+			for (; printed < scripts.size() && done[printed]; ++printed) {
+				const Result& p = results[printed];
+				cout << left << setw(6) << p.status << scripts[printed] << fixed << setprecision(1) << " (" << p.ms << " ms)";
+				if (!p.message.empty()) cout << ": " << p.message;
+				cout << endl;
+			}
+		}
+	};
+	vector<thread> threads;
+	jobs = (unsigned)min<size_t>(jobs, scripts.size());
+	for (unsigned j = 0; j < jobs; ++j) threads.emplace_back(work);
+	for (auto& t : threads) t.join();
+	double wall = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+	map<string, int> counts;
+	double total = 0;
+	for (auto& r : results) ++counts[r.status], total += r.ms;
+	cout << scripts.size() << " scripts: " << counts["PASS"] << " passed, " << counts["FAIL"] << " failed, "
+		<< counts["ERROR"] << " errors, " << counts["SKIP"] << " skipped; " << fixed << setprecision(1)
+		<< wall << " ms on " << jobs << " threads (" << total << " ms of scripts)" << endl;
+	return counts["FAIL"] || counts["ERROR"] ? 1 : 0;
+}
@@ -0,0 +1,540 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <map>
+#include <iomanip>
+#include <chrono>
+#include <cstdint>
+#include <climits>
+
+using namespace std;
+
+namespace fs = filesystem;
+
+// one VM command after loading. temp, pointer and static have fixed addresses, so they are all
+// PUSH_RAM and POP_RAM. Labels are gone: GOTO, IF_GOTO and CALL hold the index they go to.
+// HALT is the entry of Sys.halt, END is past the program
+enum Code : uint8_t {
+	PUSH_CONSTANT, PUSH_LOCAL, PUSH_ARGUMENT, PUSH_THIS, PUSH_THAT, PUSH_RAM,
+	POP_LOCAL, POP_ARGUMENT, POP_THIS, POP_THAT, POP_RAM,
+	ADD, SUB, NEG, EQ, GT, LT, AND, OR, NOT,
+	GOTO, IF_GOTO, CALL, CALL_NATIVE, FUNCTION, RETURN, RETURN_VOID, HALT, END
+};
+
+struct Instruction {
+	Code code;
+	uint8_t n;      // CALL: arguments
+	uint16_t value; // constant, segment index, address, jump target, NATIVE index or locals
+};
+
+class VM {
+public:
+	static const int SCREEN = 16384, KBD = 24576;
+
+	// what a builtin did: it may hand the call back to the VM function (FALLBACK),
+	// or stop in Sys.error with the code left in result, as the VM function would
+	enum Outcome { RETURNED, FALLBACK, ERROR };
+	typedef Outcome (VM::*Builtin)(const uint16_t* args, uint16_t& result);
+
+	struct Native {
+		string name;
+		Builtin builtin;
+		int arguments;
+		uint16_t function = 0; // the VM function, for FALLBACK
+		long long calls = 0;
+	};
+
+private:
+	vector<Instruction> code;
+	vector<uint16_t> ram = vector<uint16_t>(32768);
+	vector<Native> natives;
+	map<string, int> functions; // entry index
+	map<string, int> statics;   // first address of each class
+	unsigned pc = 0;
+	bool halted = false;
+	int error = -1;          // index of Sys.error
+	Instruction redirect;    // the CALL a builtin turns into
+
+	struct Unresolved {
+		int index;
+		string target;
+	};
+
+	static Instruction Push(const string& segment, int index, const string& klass, int& staticcount) {
+		if (segment == "constant") return { PUSH_CONSTANT, 0, (uint16_t)index };
+		if (segment == "local") return { PUSH_LOCAL, 0, (uint16_t)index };
+		if (segment == "argument") return { PUSH_ARGUMENT, 0, (uint16_t)index };
+		if (segment == "this") return { PUSH_THIS, 0, (uint16_t)index };
+		if (segment == "that") return { PUSH_THAT, 0, (uint16_t)index };
+		if (segment == "temp") return { PUSH_RAM, 0, (uint16_t)(5 + index) };
+		if (segment == "pointer") return { PUSH_RAM, 0, (uint16_t)(3 + index) };
+		if (segment == "static") {
+			// resolved once the class has its addresses
+			staticcount = max(staticcount, index + 1);
+			return { PUSH_RAM, 1, (uint16_t)index };
+		}
+		throw runtime_error(klass + ": unknown segment " + segment);
+	}
+
+	// the class's statics go after the ones loaded before it, from RAM 16
+	int LoadFile(const fs::path& path, vector<Unresolved>& calls, int& staticbase) {
+		ifstream ifs(path);
+		string klass = path.stem().string(), line, function;
+		size_t first = code.size();
+		int staticcount = 0;
+		map<string, int> labels;
+		vector<Unresolved> jumps;
+		while (getline(ifs, line)) {
+			size_t comment = line.find("//");
+			if (comment != string::npos) line.erase(comment);
+			istringstream words(line);
+			string command, arg1;
+			int arg2 = 0;
+			if (!(words >> command)) continue;
+			words >> arg1 >> arg2;
+
+			if (command == "push" || command == "pop") {
+				Instruction in = Push(arg1, arg2, klass, staticcount);
+				if (command == "pop") {
+					if (in.code == PUSH_CONSTANT) throw runtime_error(klass + ": pop constant");
+					in.code = Code(in.code - PUSH_LOCAL + POP_LOCAL);
+				}
+				code.push_back(in);
+			} else if (command == "label") labels[function + "$" + arg1] = code.size();
+			else if (command == "goto" || command == "if-goto") {
+				jumps.push_back({ (int)code.size(), function + "$" + arg1 });
+				code.push_back({ command == "goto" ? GOTO : IF_GOTO, 0, 0 });
+			} else if (command == "call") {
+				calls.push_back({ (int)code.size(), arg1 });
+				code.push_back({ CALL, (uint8_t)arg2, 0 });
+			} else if (command == "function") {
+				function = arg1;
+				functions[function] = code.size();
+				code.push_back({ FUNCTION, 0, (uint16_t)arg2 });
+			} else if (command == "return") code.push_back({ RETURN, 0, 0 });
+			else if (command == "return-void") code.push_back({ RETURN_VOID, 0, 0 });
+			else {
+				static const map<string, Code> ARITHMETIC = {
+					{"add", ADD}, {"sub", SUB}, {"neg", NEG}, {"eq", EQ}, {"gt", GT},
+					{"lt", LT}, {"and", AND}, {"or", OR}, {"not", NOT}
+				};
+				auto it = ARITHMETIC.find(command);
+				if (it == ARITHMETIC.end()) throw runtime_error(klass + ": unknown command " + command);
+				code.push_back({ it->second, 0, 0 });
+			}
+		}
+		for (auto& [index, target] : jumps) {
+			auto it = labels.find(target);
+			if (it == labels.end()) throw runtime_error(klass + ": no label " + target);
+			code[index].value = it->second;
+		}
+		for (size_t i = first; i < code.size(); ++i) {
+			Instruction& in = code[i];
+			if ((in.code == PUSH_RAM || in.code == POP_RAM) && in.n) {
+				in.value += staticbase;
+				in.n = 0;
+			}
+		}
+		statics[klass] = staticbase;
+		staticbase += staticcount;
+		return staticcount;
+	}
+
+	static int16_t S(uint16_t v) { return (int16_t)v; }
+
+	uint16_t& Static(const char* klass, int index) { return ram[statics[klass] + index]; }
+
+	// the builtins do what the OS functions in 11/OS do, word for word where another
+	// function can see it: the heap blocks, the screen and the cursor end up the same.
+	// Scratch memory the OS keeps to itself (Math's powers of two) is left alone
+
+	Outcome Multiply(const uint16_t* args, uint16_t& result) {
+		if (args[0] == 0x8000 || args[1] == 0x8000) return FALLBACK;
+		result = (uint16_t)(S(args[0]) * S(args[1]));
+		return RETURNED;
+	}
+
+	Outcome Divide(const uint16_t* args, uint16_t& result) {
+		if (args[1] == 0) {
+			result = 3;
+			return ERROR;
+		}
+		if (args[0] == 0x8000 || args[1] == 0x8000) return FALLBACK;
+		result = (uint16_t)(S(args[0]) / S(args[1]));
+		return RETURNED;
+	}
+
+	// first fit from 2048, joining free neighbours on the way; a block is [size, next]
+	// followed by the words handed out
+	Outcome Alloc(const uint16_t* args, uint16_t& result) {
+		int16_t size = S(args[0]);
+		if (size < 0) {
+			result = 5;
+			return ERROR;
+		}
+		if (size == 0) size = 1;
+		uint16_t block = 2048;
+		auto at = [&](uint16_t address) -> uint16_t& { return ram[address & 0x7fff]; };
+		while (S(block) < 16383 && S(at(block)) < size) {
+			uint16_t next = at(block + 1);
+			if (at(block) == 0 || S(next) > 16382 || at(next) == 0) block = next;
+			else {
+				at(block) = at(block + 1) - block + at(next);
+				at(block + 1) = at(next + 1) == (uint16_t)(next + 2) ? block + 2 : at(next + 1);
+			}
+		}
+		if (S(block + size) > 16379) {
+			result = 6;
+			return ERROR;
+		}
+		if (S(at(block)) > size + 2) {
+			at(block + size + 2) = at(block) - size - 2;
+			at(block + size + 3) = at(block + 1) == (uint16_t)(block + 2) ? block + size + 4 : at(block + 1);
+			at(block + 1) = block + size + 2;
+		}
+		at(block) = 0;
+		result = block + 2;
+		return RETURNED;
+	}
+
+	Outcome DrawRectangle(const uint16_t* args, uint16_t& result) {
+		int16_t x1 = S(args[0]), y1 = S(args[1]), x2 = S(args[2]), y2 = S(args[3]);
+		if (x1 > x2 || y1 > y2 || x1 < 0 || x2 > 511 || y1 < 0 || y2 > 255) {
+			result = 9;
+			return ERROR;
+		}
+		uint16_t screen = Static("Screen", 1);
+		bool black = Static("Screen", 2) != 0;
+		int left = x1 / 16, right = x2 / 16;
+		uint16_t first = ~((1 << (x1 % 16)) - 1), last = (2 << (x2 % 16)) - 1;
+		for (int y = y1; y <= y2; ++y) {
+			uint16_t* row = &ram[(uint16_t)(screen + y * 32) & 0x7fff];
+			for (int word = left; word <= right; ++word) {
+				uint16_t mask = 0xffff;
+				if (word == left) mask &= first;
+				if (word == right) mask &= last;
+				row[word] = black ? row[word] | mask : row[word] & ~mask;
+			}
+		}
+		result = 0;
+		return RETURNED;
+	}
+
+	// newline and backspace move the cursor back, which is left to the VM
+	Outcome PrintChar(const uint16_t* args, uint16_t& result) {
+		uint16_t c = args[0];
+		if (c == 128 || c == 129) return FALLBACK;
+		uint16_t &column = Static("Output", 0), &cursor = Static("Output", 1), &left = Static("Output", 2);
+		uint16_t screen = Static("Output", 4);
+		if (S(c) < 32 || S(c) > 126) c = 0;
+		uint16_t map = ram[(uint16_t)((left ? Static("Output", 5) : Static("Output", 6)) + c) & 0x7fff];
+		uint16_t address = cursor;
+		for (int i = 0; i < 11; ++i) {
+			uint16_t& word = ram[(uint16_t)(address + screen) & 0x7fff];
+			uint16_t kept = left ? word & 0xff00 : word & 0x00ff;
+			word = ram[(uint16_t)(map + i) & 0x7fff] | kept;
+			address += 32;
+		}
+		if ((uint16_t)~left) {
+			++column;
+			++cursor;
+		}
+		if (column == 32) {
+			cursor = cursor + 352 - column;
+			column = 0;
+			left = 0xffff;
+			if (cursor == 8128) cursor = 32;
+		} else left = ~left;
+		result = 0;
+		return RETURNED;
+	}
+
+public:
+	// the .vm files of dir, then those of os whose class dir doesn't have
+	void Load(const string& dir, const string& os, bool native) {
+		vector<fs::path> files;
+		map<string, bool> classes;
+		for (const string& d : { dir, os }) {
+			if (d.empty()) continue;
+			vector<fs::path> found;
+			if (fs::is_directory(d)) {
+				for (auto& p : fs::directory_iterator(d))
+					if (p.path().extension() == ".vm") found.push_back(p.path());
+			} else found.push_back(d);
+			sort(found.begin(), found.end());
+			for (auto& p : found)
+				if (!classes[p.stem().string()]) {
+					classes[p.stem().string()] = true;
+					files.push_back(p);
+				}
+		}
+		if (files.empty()) throw runtime_error("no .vm files in " + dir);
+
+		// the bootstrap: SP = 256, call Sys.init with END as the return address
+		vector<Unresolved> calls;
+		int staticbase = 16;
+		bool boot = classes.count("Sys");
+		if (boot) {
+			calls.push_back({ 0, "Sys.init" });
+			code.push_back({ CALL, 0, 0 });
+		}
+		for (auto& file : files) LoadFile(file, calls, staticbase);
+		if (staticbase > 256) cerr << "the statics run past RAM 255 into the stack" << endl;
+		code.push_back({ END, 0, 0 });
+		if (code.size() > 65535) throw runtime_error("more than 65535 VM commands");
+
+		if (native) {
+			natives = {
+				{ "Math.multiply", &VM::Multiply, 2 },
+				{ "Math.divide", &VM::Divide, 2 },
+				{ "Memory.alloc", &VM::Alloc, 1 },
+				{ "Screen.drawRectangle", &VM::DrawRectangle, 4 },
+				{ "Output.printChar", &VM::PrintChar, 1 }
+			};
+		}
+		auto halt = functions.find("Sys.halt");
+		if (halt != functions.end()) code[halt->second] = { HALT, 0, 0 };
+		auto err = functions.find("Sys.error");
+		if (err != functions.end()) error = err->second;
+		for (auto& [index, target] : calls) {
+			auto it = functions.find(target);
+			if (it == functions.end()) throw runtime_error("no function " + target);
+			code[index].value = it->second;
+			for (size_t i = 0; i < natives.size(); ++i)
+				if (natives[i].name == target && natives[i].arguments == code[index].n) {
+					natives[i].function = it->second;
+					code[index] = { CALL_NATIVE, code[index].n, (uint16_t)i };
+				}
+		}
+		if (boot) ram[0] = 256;
+	}
+
+	uint16_t& Ram(int address) { return ram[address & 0x7fff]; }
+
+	unsigned PC() { return pc; }
+
+	// starts at a function without calling it, as the VM emulator does with Sys.init
+	void Enter(const string& function) {
+		auto it = functions.find(function);
+		if (it == functions.end()) throw runtime_error("no function " + function);
+		pc = it->second;
+		halted = false;
+	}
+
+	bool Halted() { return halted; }
+
+	const vector<Native>& Natives() { return natives; }
+
+	// runs up to limit VM commands and returns how many ran. SP is kept out of RAM while
+	// running and is written back when the run stops
+	long long Run(long long limit) {
+		const Instruction* prog = code.data();
+		uint16_t* mem = ram.data();
+		unsigned pc = this->pc, sp = ram[0];
+		long long n = 0;
+		const Instruction* in;
+		uint16_t result;
+		if (halted || limit <= 0) return 0;
+
+#define AT(address) mem[(address) & 0x7fff]
+#define TOP mem[(sp - 1) & 0x7fff]
+#if defined(__GNUC__) && !defined(VMRUN_SWITCH)
+		// same order as Code
+		static const void* labels[] = {
+			&&L_PUSH_CONSTANT, &&L_PUSH_LOCAL, &&L_PUSH_ARGUMENT, &&L_PUSH_THIS, &&L_PUSH_THAT, &&L_PUSH_RAM,
+			&&L_POP_LOCAL, &&L_POP_ARGUMENT, &&L_POP_THIS, &&L_POP_THAT, &&L_POP_RAM,
+			&&L_ADD, &&L_SUB, &&L_NEG, &&L_EQ, &&L_GT, &&L_LT, &&L_AND, &&L_OR, &&L_NOT,
+			&&L_GOTO, &&L_IF_GOTO, &&L_CALL, &&L_CALL_NATIVE, &&L_FUNCTION, &&L_RETURN, &&L_RETURN_VOID, &&L_HALT, &&L_END
+		};
+#define OP(name) L_##name
+#define NEXT() do { if (++n == limit) goto done; in = &prog[pc]; goto *labels[in->code]; } while (0)
+		in = &prog[pc];
+		goto *labels[in->code];
+#else
+#define OP(name) case name
+#define NEXT() do { if (++n == limit) goto done; goto dispatch; } while (0)
+	dispatch:
+		in = &prog[pc];
+		switch (in->code) {
+#endif
+		OP(PUSH_CONSTANT): AT(sp++) = in->value; ++pc; NEXT();
+		OP(PUSH_LOCAL): AT(sp) = AT(mem[1] + in->value); ++sp; ++pc; NEXT();
+		OP(PUSH_ARGUMENT): AT(sp) = AT(mem[2] + in->value); ++sp; ++pc; NEXT();
+		OP(PUSH_THIS): AT(sp) = AT(mem[3] + in->value); ++sp; ++pc; NEXT();
+		OP(PUSH_THAT): AT(sp) = AT(mem[4] + in->value); ++sp; ++pc; NEXT();
+		OP(PUSH_RAM): AT(sp) = mem[in->value]; ++sp; ++pc; NEXT();
+		OP(POP_LOCAL): --sp; AT(mem[1] + in->value) = AT(sp); ++pc; NEXT();
+		OP(POP_ARGUMENT): --sp; AT(mem[2] + in->value) = AT(sp); ++pc; NEXT();
+		OP(POP_THIS): --sp; AT(mem[3] + in->value) = AT(sp); ++pc; NEXT();
+		OP(POP_THAT): --sp; AT(mem[4] + in->value) = AT(sp); ++pc; NEXT();
+		OP(POP_RAM): --sp; mem[in->value] = AT(sp); ++pc; NEXT();
+		OP(ADD): --sp; TOP += AT(sp); ++pc; NEXT();
+		OP(SUB): --sp; TOP -= AT(sp); ++pc; NEXT();
+		OP(NEG): TOP = -TOP; ++pc; NEXT();
+		OP(EQ): --sp; TOP = TOP == AT(sp) ? 0xffff : 0; ++pc; NEXT();
+		OP(GT): --sp; TOP = (int16_t)TOP > (int16_t)AT(sp) ? 0xffff : 0; ++pc; NEXT();
+		OP(LT): --sp; TOP = (int16_t)TOP < (int16_t)AT(sp) ? 0xffff : 0; ++pc; NEXT();
+		OP(AND): --sp; TOP &= AT(sp); ++pc; NEXT();
+		OP(OR): --sp; TOP |= AT(sp); ++pc; NEXT();
+		OP(NOT): TOP = ~TOP; ++pc; NEXT();
+		OP(GOTO): pc = in->value; NEXT();
+		OP(IF_GOTO): --sp; pc = AT(sp) ? in->value : pc + 1; NEXT();
+		OP(CALL):
+		call:
+			// the frame is the one the translated code builds, with the index to return to
+			AT(sp) = pc + 1;
+			AT(sp + 1) = mem[1];
+			AT(sp + 2) = mem[2];
+			AT(sp + 3) = mem[3];
+			AT(sp + 4) = mem[4];
+			sp += 5;
+			mem[2] = sp - 5 - in->n;
+			mem[1] = sp;
+			pc = in->value;
+			NEXT();
+		OP(CALL_NATIVE):
+			{
+				Native& native = natives[in->value];
+				mem[0] = sp;
+				switch ((this->*native.builtin)(&AT(sp - in->n), result)) {
+				case RETURNED:
+					++native.calls;
+					sp -= in->n;
+					AT(sp++) = result;
+					++pc;
+					NEXT();
+				case FALLBACK:
+					redirect = { CALL, in->n, native.function };
+					in = &redirect;
+					goto call;
+				case ERROR:
+					// Sys.error(code) from here; it never comes back
+					++native.calls;
+					if (error < 0) {
+						halted = true;
+						goto done;
+					}
+					sp -= in->n;
+					AT(sp++) = result;
+					redirect = { CALL, 1, (uint16_t)error };
+					in = &redirect;
+					goto call;
+				}
+			}
+		OP(FUNCTION):
+			for (int i = 0; i < in->value; ++i) AT(sp++) = 0;
+			++pc;
+			NEXT();
+		OP(RETURN):
+			{
+				unsigned frame = mem[1], arg = mem[2];
+				pc = AT(frame - 5);
+				AT(arg) = TOP;
+				sp = arg + 1;
+				mem[4] = AT(frame - 1);
+				mem[3] = AT(frame - 2);
+				mem[2] = AT(frame - 3);
+				mem[1] = AT(frame - 4);
+			}
+			NEXT();
+		OP(RETURN_VOID):
+			{
+				unsigned frame = mem[1];
+				pc = AT(frame - 5);
+				sp = mem[2];
+				mem[4] = AT(frame - 1);
+				mem[3] = AT(frame - 2);
+				mem[2] = AT(frame - 3);
+				mem[1] = AT(frame - 4);
+			}
+			NEXT();
+		OP(HALT): halted = true; goto done;
+		OP(END): halted = true; goto done;
+#if !defined(__GNUC__) || defined(VMRUN_SWITCH)
+		}
+#endif
+#undef OP
+#undef NEXT
+#undef AT
+#undef TOP
+
+	done:
+		this->pc = pc;
+		ram[0] = sp;
+		return n;
+	}
+
+	// 512x256, one bit per pixel, as a plain PBM
+	void WriteScreen(string filename) {
+		ofstream ofs(filename);
+		ofs << "P1" << endl << "512 256" << endl;
+		for (int row = 0; row < 256; ++row) {
+			for (int col = 0; col < 512; ++col)
+				ofs << ((ram[SCREEN + row * 32 + col / 16] >> (col % 16)) & 1) << (col % 64 == 63 ? "\n" : " ");
+		}
+	}
+};
+
+#ifndef NO_MAIN
+int main(int argc, char** argv) {
+	string source, os, screenfile;
+	bool native = false;
+	long long steps = LLONG_MAX;
+	vector<pair<int, int> > sets, prints;
+	int key = 0;
+	for (int i = 1; i < argc; ++i) {
+		string arg = argv[i];
+		if (arg == "--steps" && i + 1 < argc) steps = stoll(argv[++i]);
+		else if (arg == "--os" && i + 1 < argc) os = argv[++i];
+		else if (arg == "--native") native = true;
+		else if (arg == "--ram" && i + 1 < argc) {
+			// address=value
+			string s = argv[++i];
+			size_t eq = s.find('=');
+			sets.push_back({ stoi(s.substr(0, eq)), stoi(s.substr(eq + 1)) });
+		} else if (arg == "--print" && i + 1 < argc) {
+			// address or first-last
+			string s = argv[++i];
+			size_t dash = s.find('-');
+			int first = stoi(s.substr(0, dash));
+			prints.push_back({ first, dash == string::npos ? first : stoi(s.substr(dash + 1)) });
+		} else if (arg == "--screen" && i + 1 < argc) screenfile = argv[++i];
+		else if (arg == "--key" && i + 1 < argc) key = stoi(argv[++i]);
+		else source = arg;
+	}
+	if (source.empty()) {
+		cerr << "usage: VMRun [--os dir] [--native] [--steps n] [--ram addr=value] [--print addr[-addr]] [--screen out.pbm] [--key code] <dir|file.vm>" << endl;
+		return 1;
+	}
+
+	VM vm;
+	try {
+		vm.Load(source, os, native);
+	} catch (exception& e) {
+		cerr << "VMRun: " << e.what() << endl;
+		return 1;
+	}
+	for (auto& [address, value] : sets) vm.Ram(address) = value;
+	vm.Ram(VM::KBD) = key;
+
+	auto start = chrono::steady_clock::now();
+	long long n = vm.Run(steps);
+	double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+	for (auto& [first, last] : prints)
+		for (int address = first; address <= last; ++address)
+			cout << "RAM[" << address << "] = " << (int16_t)vm.Ram(address) << endl;
+	if (!screenfile.empty()) vm.WriteScreen(screenfile);
+
+	cout << fixed << setprecision(2)
+		<< (vm.Halted() ? "halted" : "stopped") << " at " << vm.PC() << " after " << n << " VM commands, "
+		<< ms << " ms, " << (ms > 0 ? n / ms / 1000 : 0) << " M commands/s" << endl;
+	for (auto& native : vm.Natives())
+		if (native.calls) cout << "native " << native.name << " " << native.calls << " calls" << endl;
+	return 0;
+}
+#endif